@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   assets.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/15 11:02:48 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/15 16:38:05 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+static void	asset_decode(t_game *game, t_img *img, char *path)
+{
+	char	*ext;
+
+	ext = ft_strrchr(path, '.');
+	if (ext && !ft_strncmp(ext, ".png", 5))
+		img->ptr = mlx_png_file_to_image(game->mlx, path, &img->w, &img->h);
+	else
+		img->ptr = mlx_xpm_file_to_image(game->mlx, path, &img->w, &img->h);
+}
+
+static void	*asset_worker(void *arg)
+{
+	t_assets	*a;
+	int			i;
+
+	a = arg;
+	while (1)
+	{
+		pthread_mutex_lock(&a->lock);
+		i = a->next++;
+		pthread_mutex_unlock(&a->lock);
+		if (i >= ASSETS)
+			return (NULL);
+		asset_decode(a->game, a->img[i], a->path[i]);
+	}
+}
+
+static void	asset_setup(t_game *game, t_assets *a)
+{
+	a->game = game;
+	a->next = 0;
+	a->img[0] = &game->space;
+	a->img[1] = &game->wall;
+	a->img[2] = &game->player;
+	a->img[3] = &game->coin;
+	a->img[4] = &game->exit;
+	a->path[0] = SPACE;
+	a->path[1] = WALL;
+	a->path[2] = PLAYER;
+	a->path[3] = COIN;
+	a->path[4] = EXIT;
+	game->space.ptr = NULL;
+	game->wall.ptr = NULL;
+	game->player.ptr = NULL;
+	game->coin.ptr = NULL;
+	game->exit.ptr = NULL;
+	game->frame.ptr = NULL;
+	game->stage.ptr = NULL;
+}
+
+static void	asset_pool(t_assets *a)
+{
+	pthread_t	tid[ASSET_THREADS];
+	int			started[ASSET_THREADS];
+	int			i;
+
+	pthread_mutex_init(&a->lock, NULL);
+	i = 0;
+	while (i < ASSET_THREADS)
+	{
+		started[i] = !pthread_create(&tid[i], NULL, asset_worker, a);
+		i++;
+	}
+	asset_worker(a);
+	i = 0;
+	while (i < ASSET_THREADS)
+	{
+		if (started[i])
+			pthread_join(tid[i], NULL);
+		i++;
+	}
+	pthread_mutex_destroy(&a->lock);
+}
+
+void	load_textures(t_game *game)
+{
+	t_assets	a;
+	long		start;
+	int			i;
+
+	start = clock_us();
+	asset_setup(game, &a);
+	asset_pool(&a);
+	i = 0;
+	while (i < ASSETS)
+		upload_texture(game, a.img[i++]);
+	game->t_assets = clock_us() - start;
+}
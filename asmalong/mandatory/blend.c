@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   blend.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/04 15:21:08 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/16 10:21:37 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+unsigned int	blend_px(unsigned int dst, unsigned int src)
+{
+	unsigned int	a;
+	unsigned int	out;
+	unsigned int	c;
+	unsigned int	shift;
+
+	a = src >> 24;
+	out = dst & 0xFF000000;
+	shift = 0;
+	while (shift < 24)
+	{
+		c = ((src >> shift) & 0xFF) * (255 - a)
+			+ ((dst >> shift) & 0xFF) * a + 128;
+		out |= (((c + (c >> 8)) >> 8) & 0xFF) << shift;
+		shift += 8;
+	}
+	return (out);
+}
+
+static void	blend_row(unsigned int *dst, unsigned int *src, int n)
+{
+	int	i;
+
+	i = blend_wide(dst, src, n);
+	while (i < n)
+	{
+		dst[i] = blend_px(dst[i], src[i]);
+		i++;
+	}
+}
+
+void	blit_img(t_img *frame, t_img *img, int x, int y)
+{
+	int	w;
+	int	h;
+	int	r;
+
+	w = img->w;
+	if (w > TILE)
+		w = TILE;
+	if (x + w > frame->w)
+		w = frame->w - x;
+	h = img->h;
+	if (h > TILE)
+		h = TILE;
+	if (y + h > frame->h)
+		h = frame->h - y;
+	r = 0;
+	while (r < h)
+	{
+		blend_row(frame->px + (y + r) * frame->line + x,
+			img->px + r * img->line, w);
+		r++;
+	}
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   blend_sse.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/04 16:02:51 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/04 17:46:33 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+#ifdef __SSE2__
+
+static __m128i	blend_half(__m128i s, __m128i d, __m128i a)
+{
+	__m128i	c;
+
+	c = _mm_add_epi16(_mm_mullo_epi16(s, _mm_sub_epi16(_mm_set1_epi16(255),
+					a)), _mm_mullo_epi16(d, a));
+	c = _mm_add_epi16(c, _mm_set1_epi16(128));
+	return (_mm_srli_epi16(_mm_add_epi16(c, _mm_srli_epi16(c, 8)), 8));
+}
+
+int	blend_wide(unsigned int *dst, unsigned int *src, int n)
+{
+	__m128i	s;
+	__m128i	d;
+	__m128i	a;
+	__m128i	c;
+	int		i;
+
+	i = 0;
+	while (i + 4 <= n)
+	{
+		s = _mm_loadu_si128((__m128i *)(src + i));
+		d = _mm_loadu_si128((__m128i *)(dst + i));
+		a = _mm_srli_epi32(s, 24);
+		a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+		c = _mm_packus_epi16(blend_half(_mm_unpacklo_epi8(s,
+						_mm_setzero_si128()), _mm_unpacklo_epi8(d,
+						_mm_setzero_si128()), _mm_unpacklo_epi32(a, a)),
+				blend_half(_mm_unpackhi_epi8(s, _mm_setzero_si128()),
+					_mm_unpackhi_epi8(d, _mm_setzero_si128()),
+					_mm_unpackhi_epi32(a, a)));
+		c = _mm_or_si128(_mm_and_si128(c, _mm_set1_epi32(0x00FFFFFF)),
+				_mm_and_si128(d, _mm_set1_epi32(0xFF000000)));
+		_mm_storeu_si128((__m128i *)(dst + i), c);
+		i += 4;
+	}
+	return (i);
+}
+
+#else
+
+int	blend_wide(unsigned int *dst, unsigned int *src, int n)
+{
+	(void)dst;
+	(void)src;
+	(void)n;
+	return (0);
+}
+
+#endif
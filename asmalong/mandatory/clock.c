@@ -1,32 +1,30 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   get_next_line.h                                    :+:      :+:    :+:   */
+/*   clock.c                                            :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2024/04/18 12:03:12 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Created: 2024/07/15 11:02:48 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/15 16:38:05 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#ifndef GET_NEXT_LINE_H
-# define GET_NEXT_LINE_H
+#include "../so_long.h"
 
-# include <stdio.h>
-# include <fcntl.h>
-# include <unistd.h>
-# include <stdlib.h>
-# include <string.h>
+long	clock_us(void)
+{
+	struct timespec	ts;
 
-# ifndef BUFFER_SIZE
-#  define BUFFER_SIZE 10000
-# endif
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000L + ts.tv_nsec / 1000);
+}
 
-char	*get_next_line(int fd);
-int		gnl_strlen(char *s);
-char	*gnl_strchr(char *s);
-char	*gnl_strdup(char	*remainder);
-char	*gnl_strjoin(char *old, char *new);
-
-#endif
+void	report_startup(t_game *game)
+{
+	if (game->t_start < 0)
+		return ;
+	ft_printf("startup: assets %d us, first frame %d us\n",
+		(int)game->t_assets, (int)(clock_us() - game->t_start));
+	game->t_start = -1;
+}
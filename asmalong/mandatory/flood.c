@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flood.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/09 09:41:37 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/09 11:20:05 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+static int	fill_open(t_game *game, t_fill *fill, int x, int y)
+{
+	int	i;
+
+	if (game->map[y][x] == '1')
+		return (0);
+	i = y * game->w + x;
+	return (!((fill->seen[i >> 6] >> (i & 63)) & 1));
+}
+
+static int	fill_skip(t_fill *fill, int i, int end)
+{
+	if ((i & 63) == 0 && i + 63 <= end && fill->seen[i >> 6] == ~0UL)
+		return (64);
+	return (0);
+}
+
+static void	fill_row(t_game *game, t_fill *fill, int y, int *span)
+{
+	int	x;
+	int	i;
+	int	run;
+	int	step;
+
+	x = span[0];
+	run = 0;
+	while (x <= span[1] && fill->top >= 0)
+	{
+		i = y * game->w + x;
+		step = fill_skip(fill, i, y * game->w + span[1]);
+		if (step)
+			run = 0;
+		else if (game->map[y][x] != '1'
+			&& !((fill->seen[i >> 6] >> (i & 63)) & 1))
+		{
+			if (!run && !fill_push(fill, i))
+				fill->top = -1;
+			run = 1;
+		}
+		else
+			run = 0;
+		x += step + (step == 0);
+	}
+}
+
+static void	fill_mark(t_game *game, t_fill *fill, int y, int *span)
+{
+	int		x;
+	int		i;
+	char	c;
+
+	x = span[0];
+	while (x <= span[1])
+	{
+		i = y * game->w + x;
+		fill->seen[i >> 6] |= 1UL << (i & 63);
+		c = game->map[y][x];
+		if (c == 'E')
+			game->find_e = 1;
+		if (c == 'C')
+			game->find_c++;
+		x++;
+	}
+}
+
+void	fill_span(t_game *game, t_fill *fill, int seed)
+{
+	int	span[2];
+	int	y;
+
+	y = seed / game->w;
+	span[0] = seed % game->w;
+	if (!fill_open(game, fill, span[0], y))
+		return ;
+	span[1] = span[0];
+	while (fill_open(game, fill, span[0] - 1, y))
+		span[0]--;
+	while (fill_open(game, fill, span[1] + 1, y))
+		span[1]++;
+	fill_mark(game, fill, y, span);
+	fill_row(game, fill, y - 1, span);
+	if (fill->top >= 0)
+		fill_row(game, fill, y + 1, span);
+}
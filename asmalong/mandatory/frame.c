@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/04 14:37:52 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/15 16:38:05 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+static int	frame_image(t_game *game, t_img *img, int w, int h)
+{
+	int	bpp;
+	int	line;
+	int	endian;
+
+	img->ptr = mlx_new_image(game->mlx, w, h);
+	if (img->ptr == NULL)
+		return (0);
+	img->px = (unsigned int *)mlx_get_data_addr(img->ptr, &bpp, &line,
+			&endian);
+	img->line = line / 4;
+	img->w = w;
+	img->h = h;
+	return (1);
+}
+
+void	frame_init(t_game *game)
+{
+	if (!frame_image(game, &game->frame, game->w * TILE, game->h * TILE)
+		|| !frame_image(game, &game->stage, STAGE, STAGE))
+	{
+		destroy_textures(game);
+		map_error(game, "Error\n Can't create the frame!");
+	}
+	game->dirty[0] = game->frame.w;
+	game->dirty[1] = game->frame.h;
+	game->dirty[2] = 0;
+	game->dirty[3] = 0;
+}
+
+void	frame_mark(t_game *game, int x, int y)
+{
+	if (x < game->dirty[0])
+		game->dirty[0] = x;
+	if (y < game->dirty[1])
+		game->dirty[1] = y;
+	if (x + TILE > game->dirty[2])
+		game->dirty[2] = x + TILE;
+	if (y + TILE > game->dirty[3])
+		game->dirty[3] = y + TILE;
+}
+
+static void	stage_copy(t_game *game, int x, int y)
+{
+	unsigned int	*src;
+	unsigned int	*dst;
+	int				r;
+	int				i;
+
+	r = 0;
+	while (r < STAGE)
+	{
+		src = game->frame.px + (y + r) * game->frame.line + x;
+		dst = game->stage.px + r * game->stage.line;
+		i = 0;
+		while (i < STAGE)
+		{
+			dst[i] = src[i];
+			i++;
+		}
+		r++;
+	}
+	mlx_put_image_to_window(game->mlx, game->mlx_win, game->stage.ptr, x, y);
+}
+
+int	present_frame(t_game *game)
+{
+	int	x;
+	int	y;
+
+	if (game->dirty[2] <= game->dirty[0])
+		return (0);
+	x = game->dirty[0];
+	y = game->dirty[1];
+	if (x + STAGE > game->frame.w)
+		x = game->frame.w - STAGE;
+	if (y + STAGE > game->frame.h)
+		y = game->frame.h - STAGE;
+	if (game->dirty[2] - game->dirty[0] <= STAGE && x >= 0
+		&& game->dirty[3] - game->dirty[1] <= STAGE && y >= 0)
+		stage_copy(game, x, y);
+	else
+		mlx_put_image_to_window(game->mlx, game->mlx_win,
+			game->frame.ptr, 0, 0);
+	game->dirty[0] = game->frame.w;
+	game->dirty[1] = game->frame.h;
+	game->dirty[2] = 0;
+	game->dirty[3] = 0;
+	report_startup(game);
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/18 12:02:14 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/04 17:46:33 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,18 +16,18 @@ void	ft_if_flag2_flag3_render(t_game *game, int next_x, int next_y)
 {
 	if (game->flag == 2)
 	{
-		rendering_img(game, SPACE, next_x, next_y);
-		rendering_img(game, PLAYER, next_x, next_y);
-		rendering_img(game, EXIT, game->p_pos_x, game->p_pos_y);
+		rendering_img(game, &game->space, next_x, next_y);
+		rendering_img(game, &game->player, next_x, next_y);
+		rendering_img(game, &game->exit, game->p_pos_x, game->p_pos_y);
 		game->p_pos_x = next_x;
 		game->p_pos_y = next_y;
 		game->flag = 0;
 	}
 	if (game->flag == 3)
 	{
-		rendering_img(game, EXIT, next_x, next_y);
-		rendering_img(game, PLAYER, next_x, next_y);
-		rendering_img(game, EXIT, game->p_pos_x, game->p_pos_y);
+		rendering_img(game, &game->exit, next_x, next_y);
+		rendering_img(game, &game->player, next_x, next_y);
+		rendering_img(game, &game->exit, game->p_pos_x, game->p_pos_y);
 		game->p_pos_x = next_x;
 		game->p_pos_y = next_y;
 		game->flag = 1;
@@ -38,17 +38,17 @@ void	rendering_move(t_game *game, int next_x, int next_y)
 {
 	if (game->flag == 0)
 	{
-		rendering_img(game, SPACE, next_x, next_y);
-		rendering_img(game, PLAYER, next_x, next_y);
-		rendering_img(game, SPACE, game->p_pos_x, game->p_pos_y);
+		rendering_img(game, &game->space, next_x, next_y);
+		rendering_img(game, &game->player, next_x, next_y);
+		rendering_img(game, &game->space, game->p_pos_x, game->p_pos_y);
 		game->p_pos_x = next_x;
 		game->p_pos_y = next_y;
 	}
 	if (game->flag == 1)
 	{
-		rendering_img(game, EXIT, next_x, next_y);
-		rendering_img(game, PLAYER, next_x, next_y);
-		rendering_img(game, SPACE, game->p_pos_x, game->p_pos_y);
+		rendering_img(game, &game->exit, next_x, next_y);
+		rendering_img(game, &game->player, next_x, next_y);
+		rendering_img(game, &game->space, game->p_pos_x, game->p_pos_y);
 		game->p_pos_x = next_x;
 		game->p_pos_y = next_y;
 	}
@@ -6,53 +6,92 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/18 11:59:50 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/12 13:27:19 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../so_long.h"
 
-void	ft_check_map(t_game *game, char *read_map)
+static char	*map_scan(t_game *game, char *buf, int size)
 {
-	int	i;
+	char	*err;
+	int		start;
+	int		i;
 
+	err = NULL;
+	start = 0;
+	game->w = -1;
+	i = -1;
+	while (++i < size)
+	{
+		if (buf[i] == '\n' && i == start)
+			return ("Error\n Map invalid\n");
+		if (buf[i] == '\n' || i == size - 1)
+		{
+			if (game->w < 0)
+				game->w = i - start + (buf[i] != '\n');
+			if (i - start + (buf[i] != '\n') != game->w)
+				err = "Error\n Map invalid\n";
+			game->h++;
+			start = i + 1;
+		}
+	}
+	if (buf[size - 1] == '\n')
+		return ("Error\n Map not valid!");
+	return (err);
+}
+
+static void	map_build(t_game *game, char *buf, int size)
+{
+	char	*grid;
+	int		i;
+	int		row;
+
+	game->map = malloc(sizeof(char *) * (game->h + 1) + size + 1);
+	if (game->map == NULL)
+		return ;
+	grid = (char *)(game->map + game->h + 1);
+	game->map[0] = grid;
+	row = 1;
 	i = 0;
-	if (read_map[0] == '\n' || read_map[(ft_strlen(read_map) - 1)] == '\n')
-		ft_error("Error\n Map not valid!");
-	game->map = ft_split(read_map, '\n');
-	game->w = ft_strlen(game->map[0]);
-	while (game->map[++i])
+	while (i < size)
 	{
-		if (ft_strlen(game->map[i]) != game->w)
-			map_error(game, "Error\n Map invalid\n");
+		grid[i] = buf[i];
+		if (buf[i] == '\n')
+		{
+			grid[i] = '\0';
+			game->map[row++] = grid + i + 1;
+		}
+		i++;
 	}
-	game->h = i;
+	grid[size] = '\0';
+	game->map[game->h] = NULL;
 }
 
-char	*ft_read_map(char *file)
+void	ft_read_map(t_game *game, char *file)
 {
-	int		fd;
-	char	*read_map;
-	char	*temp_map;
+	struct stat	st;
+	char		*buf;
+	char		*err;
+	int			fd;
 
-	read_map = "";
 	fd = open(file, O_RDONLY);
-	if (fd < 0)
+	if (fd < 0 || fstat(fd, &st) < 0)
+		ft_error("Error\n Can't read map\n");
+	if (st.st_size == 0 || st.st_size > INT_MAX)
+		ft_error("Error\n Map invalid\n");
+	buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (buf == MAP_FAILED)
+		ft_error("Error\n Can't read map\n");
+	err = map_scan(game, buf, st.st_size);
+	if (err == NULL)
+		map_build(game, buf, st.st_size);
+	munmap(buf, st.st_size);
+	if (err != NULL)
+		ft_error(err);
+	if (game->map == NULL)
 		ft_error("Error\n Can't read map\n");
-	temp_map = get_next_line(fd);
-	if (temp_map == NULL)
-		temp_map_error(temp_map, "Error\n Map invalid\n");
-	while (temp_map != NULL)
-	{
-		if (temp_map != NULL && temp_map[0] == '\n')
-			temp_map_error(temp_map, "Error\n Map invalid\n");
-		read_map = ft_strjoin(read_map, temp_map);
-		temp_map = get_next_line(fd);
-	}
-	if (temp_map != NULL)
-		free(temp_map);
-	close (fd);
-	return (read_map);
 }
 
 void	ft_check_file_extension(char *file)
@@ -68,8 +107,7 @@ void	ft_check_file_extension(char *file)
 void	ft_parsing(t_game *game, char *file)
 {
 	ft_check_file_extension(file);
-	ft_check_map(game, ft_read_map(file));
-	check_walls(game);
-	game_elements(game);
-	check_map_chars(game);
+	ft_read_map(game, file);
+	check_map(game);
+	valid_exitpass(game);
 }
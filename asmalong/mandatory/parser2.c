@@ -6,86 +6,99 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/18 12:02:28 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/12 13:27:19 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../so_long.h"
 
-void	check_map_chars(t_game *game)
+static void	class_table(t_scan *scan)
 {
-	int		i;
-	int		k;
-	char	ch;
+	int	i;
 
 	i = 0;
-	while (game->map[i])
-	{
-		k = 0;
-		while (game->map[i][k])
-		{
-			ch = game->map[i][k];
-			if (ch != 'P' && ch != 'C' && ch != 'E' && ch != '0' && ch != '1')
-				map_error(game, "Error\n Invalid simbol(s) on the map!");
-			k++;
-		}
-		i++;
-	}
+	while (i < 256)
+		scan->class[i++] = CELL_BAD;
+	scan->class['0'] = CELL_SPACE;
+	scan->class['1'] = CELL_WALL;
+	scan->class['C'] = CELL_COIN;
+	scan->class['P'] = CELL_PLAYER;
+	scan->class['E'] = CELL_EXIT;
+	i = 0;
+	while (i < CELL_TYPES)
+		scan->count[i++] = 0;
+	scan->horiz = INT_MAX;
+	scan->vert = INT_MAX;
 }
 
-int	count_game_elem(t_game *game, char c)
+static void	scan_border(t_game *game, t_scan *scan, int x, int y)
 {
-	int	y;
-	int	x;
-	int	num;
+	if (game->map[y][x] == '1')
+		return ;
+	if (y == 0 && x * 2 < scan->horiz)
+		scan->horiz = x * 2;
+	else if (y == game->h - 1 && x * 2 + 1 < scan->horiz)
+		scan->horiz = x * 2 + 1;
+	if (y > 0 && x == 0 && y * 2 < scan->vert)
+		scan->vert = y * 2;
+	else if (y > 0 && x == game->w - 1 && y * 2 + 1 < scan->vert)
+		scan->vert = y * 2 + 1;
+}
 
-	y = 0;
-	num = 0;
-	while (game->map[y])
+static void	scan_row(t_game *game, t_scan *scan, int y)
+{
+	char	*row;
+	int		x;
+	int		cell;
+
+	row = game->map[y];
+	scan_border(game, scan, 0, y);
+	scan_border(game, scan, game->w - 1, y);
+	x = 0;
+	while (x < game->w)
 	{
-		x = 0;
-		while (game->map[y][x])
+		cell = scan->class[(unsigned char)row[x]];
+		scan->count[cell]++;
+		if (cell == CELL_PLAYER)
 		{
-			if (game->map[y][x] == c)
-				num++;
-			x++;
+			game->p_pos_x = x;
+			game->p_pos_y = y;
 		}
-		y++;
+		if (y == 0 || y == game->h - 1)
+			scan_border(game, scan, x, y);
+		x++;
 	}
-	return (num);
 }
 
-void	game_elements(t_game *game)
+static void	scan_report(t_game *game, t_scan *scan)
 {
-	game->collectible = count_game_elem(game, 'C');
+	if (scan->horiz != INT_MAX && scan->horiz % 2 == 0)
+		map_error(game, "Error\n The Upper boundary isn`t correct!");
+	if (scan->horiz != INT_MAX)
+		map_error(game, "Error\n The Lower boundary isn`t correct!");
+	if (scan->vert != INT_MAX && scan->vert % 2 == 0)
+		map_error(game, "Error\n The Left boundary isn`t correct!");
+	if (scan->vert != INT_MAX)
+		map_error(game, "Error\n The Right boundary isn`t correct!");
+	game->collectible = scan->count[CELL_COIN];
 	if (game->collectible < 1)
 		map_error(game, "Error\n There must be 1 or more Coins on the map!");
-	if (count_game_elem(game, 'P') != 1)
+	if (scan->count[CELL_PLAYER] != 1)
 		map_error(game, "Error\n There must be only 1 Player on the map!");
-	if (count_game_elem(game, 'E') < 1)
+	if (scan->count[CELL_EXIT] < 1)
 		map_error(game, "Error\n There must be 1 or more Exits on the map!");
+	if (scan->count[CELL_BAD] > 0)
+		map_error(game, "Error\n Invalid simbol(s) on the map!");
 }
 
-void	check_walls(t_game *game)
+void	check_map(t_game *game)
 {
-	int	i;
+	t_scan	scan;
+	int		y;
 
-	i = 0;
-	while (game->map[0][i])
-	{
-		if (game->map[0][i] != '1')
-			map_error(game, "Error\n The Upper boundary isn`t correct!");
-		if (game->map[game->h - 1][i] != '1')
-			map_error(game, "Error\n The Lower boundary isn`t correct!");
-		i++;
-	}
-	i = 1;
-	while (game->map[i])
-	{
-		if (game->map[i][0] != '1')
-			map_error(game, "Error\n The Left boundary isn`t correct!");
-		if (game->map[i][game->w - 1] != '1')
-			map_error(game, "Error\n The Right boundary isn`t correct!");
-		i++;
-	}
+	class_table(&scan);
+	y = 0;
+	while (y < game->h)
+		scan_row(game, &scan, y++);
+	scan_report(game, &scan);
 }
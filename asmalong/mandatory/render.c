@@ -6,49 +6,41 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/18 12:00:04 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/12 13:27:19 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../so_long.h"
 
-void	rendering_img(t_game *game, char *path, int x, int y)
+void	rendering_img(t_game *game, t_img *img, int x, int y)
 {
-	int	size;
-
-	size = 100;
-	x = x * size;
-	y = y * size;
-	game->img = mlx_xpm_file_to_image(game->mlx, path, &size, &size);
-	mlx_put_image_to_window(game->mlx, game->mlx_win, game->img, x, y);
-	mlx_destroy_image(game->mlx, game->img);
+	blit_img(&game->frame, img, x * TILE, y * TILE);
+	frame_mark(game, x * TILE, y * TILE);
 }
 
 void	locate_items_and_put_img(t_game *game, char c, int x, int y)
 {
 	if (c == '0')
-		rendering_img(game, SPACE, x, y);
+		rendering_img(game, &game->space, x, y);
 	if (c == '1')
 	{
-		rendering_img(game, SPACE, x, y);
-		rendering_img(game, WALL, x, y);
+		rendering_img(game, &game->space, x, y);
+		rendering_img(game, &game->wall, x, y);
 	}
 	if (c == 'P')
 	{
-		game->p_pos_x = x;
-		game->p_pos_y = y;
-		rendering_img(game, SPACE, x, y);
-		rendering_img(game, PLAYER, x, y);
+		rendering_img(game, &game->space, x, y);
+		rendering_img(game, &game->player, x, y);
 	}
 	if (c == 'C')
 	{
-		rendering_img(game, SPACE, x, y);
-		rendering_img(game, COIN, x, y);
+		rendering_img(game, &game->space, x, y);
+		rendering_img(game, &game->coin, x, y);
 	}
 	if (c == 'E')
 	{
-		rendering_img(game, SPACE, x, y);
-		rendering_img(game, EXIT, x, y);
+		rendering_img(game, &game->space, x, y);
+		rendering_img(game, &game->exit, x, y);
 	}
 }
 
@@ -57,9 +49,10 @@ void	rendering_win(t_game *game)
 	int	win_wid;
 	int	win_hgt;
 
-	win_wid = game->w * 100;
-	win_hgt = game->h * 100;
+	win_wid = game->w * TILE;
+	win_hgt = game->h * TILE;
 	game->mlx_win = mlx_new_window(game->mlx, win_wid, win_hgt, "SO_LONG");
+	frame_init(game);
 }
 
 void	rendering_map(t_game *game)
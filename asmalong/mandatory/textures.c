@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   textures.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/02 10:14:27 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/15 16:38:05 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+
+void	upload_texture(t_game *game, t_img *img)
+{
+	int	bpp;
+	int	line;
+	int	endian;
+
+	if (img->ptr == NULL)
+	{
+		destroy_textures(game);
+		map_error(game, "Error\n Can't load the images!");
+	}
+	img->px = (unsigned int *)mlx_get_data_addr(img->ptr, &bpp, &line,
+			&endian);
+	img->line = line / 4;
+}
+
+static void	drop_image(t_game *game, t_img *img)
+{
+	if (img->ptr)
+		mlx_destroy_image(game->mlx, img->ptr);
+	img->ptr = NULL;
+}
+
+void	destroy_textures(t_game *game)
+{
+	drop_image(game, &game->space);
+	drop_image(game, &game->wall);
+	drop_image(game, &game->player);
+	drop_image(game, &game->coin);
+	drop_image(game, &game->exit);
+	drop_image(game, &game->frame);
+	drop_image(game, &game->stage);
+}
@@ -6,57 +6,63 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/15 11:15:20 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/18 12:04:59 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/09 11:20:05 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../so_long.h"
 
-int	scan_exitpass(t_game *game, int x, int y)
+int	fill_push(t_fill *fill, int i)
 {
-	if (game->map[y][x] == '1')
-		return (0);
-	if (game->hash_map[y][x] == '1')
-		return (0);
+	int	*stack;
+	int	k;
+
+	if (fill->top == fill->cap)
+	{
+		stack = malloc(sizeof(int) * fill->cap * 2);
+		if (stack == NULL)
+			return (0);
+		k = -1;
+		while (++k < fill->top)
+			stack[k] = fill->stack[k];
+		free(fill->stack);
+		fill->stack = stack;
+		fill->cap *= 2;
+	}
+	fill->stack[fill->top++] = i;
 	return (1);
 }
 
-void	scanning_map(t_game *game, int x, int y)
+static void	fill_free(t_game *game, t_fill *fill, char *err)
 {
-	game->hash_map[y][x] = '1';
-	if (game->map[y][x] == 'E')
-		game->find_e = 1;
-	if (game->map[y][x] == 'C')
-		game->find_c++;
-	if (scan_exitpass(game, x, y - 1) == 1)
-		scanning_map(game, x, y - 1);
-	if (scan_exitpass(game, x + 1, y) == 1)
-		scanning_map(game, x + 1, y);
-	if (scan_exitpass(game, x, y + 1) == 1)
-		scanning_map(game, x, y + 1);
-	if (scan_exitpass(game, x - 1, y) == 1)
-		scanning_map(game, x - 1, y);
+	free(fill->seen);
+	free(fill->stack);
+	if (err)
+		map_error(game, err);
 }
 
 void	valid_exitpass(t_game *game)
 {
-	int	x;
-	int	y;
+	t_fill	fill;
+	int		words;
+	int		i;
 
-	y = 0;
-	while (y < game->h)
-	{
-		x = 0;
-		while (x < game->w)
-		{
-			game->hash_map[y][x] = '0';
-			x++;
-		}
-		y++;
-	}
-	x = game->p_pos_x;
-	y = game->p_pos_y;
-	scanning_map(game, x, y);
+	words = (game->w * game->h + 63) / 64;
+	fill.seen = malloc(sizeof(unsigned long) * words);
+	fill.stack = malloc(sizeof(int) * 64);
+	fill.top = 0;
+	fill.cap = 64;
+	if (fill.seen == NULL || fill.stack == NULL)
+		fill_free(game, &fill, "Error\n Can't allocate the map!");
+	i = 0;
+	while (i < words)
+		fill.seen[i++] = 0;
+	fill_push(&fill, game->p_pos_y * game->w + game->p_pos_x);
+	while (fill.top > 0)
+		fill_span(game, &fill, fill.stack[--fill.top]);
+	if (fill.top < 0)
+		fill_free(game, &fill, "Error\n Can't allocate the map!");
+	fill_free(game, &fill, NULL);
 	if (game->find_e != 1 || \
 		game->find_c != game->collectible)
 		map_error(game, "Error\n Map invalid\n");
@@ -0,0 +1,15 @@
+//
+// gl3.h for the headless minilibx
+//
+// mlx_int.h and the shared xpm/png loaders only need the GL scalar types,
+// so the headless build points <OpenGL/gl3.h> here instead of at OpenGL.
+//
+
+#ifndef MLX_HEADLESS_GL3_H
+# define MLX_HEADLESS_GL3_H
+
+typedef unsigned int	GLuint;
+typedef int		GLint;
+typedef float		GLfloat;
+
+#endif
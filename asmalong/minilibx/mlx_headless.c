@@ -0,0 +1,247 @@
+//
+// mlx_headless.c for minilibx
+//
+// mlx.h on top of memory only: no display, no OpenGL.
+// put_image blends like the GL backend: src alpha 0xFF keeps dst.
+//
+
+#include <OpenGL/gl3.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "mlx_int.h"
+#include "mlx_headless.h"
+
+
+// the xpm/png loaders may run on worker threads: guard the image list
+static pthread_mutex_t	mlx_img_lock = PTHREAD_MUTEX_INITIALIZER;
+
+
+void	*mlx_init()
+{
+  mlx_ptr_t	*new_mlx;
+
+  if ((new_mlx = malloc(sizeof(*new_mlx))) == NULL)
+    return ((void *)0);
+  bzero(new_mlx, sizeof(*new_mlx));
+  return ((void *)new_mlx);
+}
+
+
+void	*mlx_new_window(mlx_ptr_t *mlx_ptr, int size_x, int size_y, char *title)
+{
+  mlx_win_list_t	*newwin;
+  hl_win_t		*hw;
+
+  (void)title;
+  if ((newwin = malloc(sizeof(*newwin))) == NULL)
+    return ((void *)0);
+  if ((hw = calloc(1, sizeof(*hw))) == NULL ||
+      (hw->fb = calloc((size_t)size_x * size_y, UNIQ_BPP)) == NULL)
+    {
+      free(hw);
+      free(newwin);
+      return ((void *)0);
+    }
+  hw->width = size_x;
+  hw->height = size_y;
+  newwin->winid = hw;
+  newwin->img_list = NULL;
+  newwin->nb_flush = 0;
+  newwin->pixmgt = 1;
+  newwin->next = mlx_ptr->win_list;
+  mlx_ptr->win_list = newwin;
+  return ((void *)newwin);
+}
+
+
+int	mlx_destroy_window(mlx_ptr_t *mlx_ptr, mlx_win_list_t *win_to_del)
+{
+  mlx_win_list_t	first;
+  mlx_win_list_t	*win;
+
+  first.next = mlx_ptr->win_list;
+  win = &first;
+  while (win && win->next)
+    {
+      if (win->next == win_to_del)
+	win->next = win->next->next;
+      win = win->next;
+    }
+  mlx_ptr->win_list = first.next;
+  free(((hl_win_t *)(win_to_del->winid))->fb);
+  free(win_to_del->winid);
+  free(win_to_del);
+  return (0);
+}
+
+
+int	mlx_clear_window(mlx_ptr_t *mlx_ptr, mlx_win_list_t *win_ptr)
+{
+  hl_win_t	*hw;
+
+  (void)mlx_ptr;
+  hw = win_ptr->winid;
+  bzero(hw->fb, (size_t)hw->width * hw->height * UNIQ_BPP);
+  win_ptr->nb_flush ++;
+  return (0);
+}
+
+
+void	*mlx_new_image(mlx_ptr_t *mlx_ptr, int width, int height)
+{
+  mlx_img_list_t	*newimg;
+
+  if ((newimg = malloc(sizeof(*newimg))) == NULL)
+    return ((void *)0);
+  if ((newimg->buffer = calloc((size_t)width * height, UNIQ_BPP)) == NULL)
+    {
+      free(newimg);
+      return ((void *)0);
+    }
+  newimg->width = width;
+  newimg->height = height;
+  pthread_mutex_lock(&mlx_img_lock);
+  newimg->next = mlx_ptr->img_list;
+  mlx_ptr->img_list = newimg;
+  pthread_mutex_unlock(&mlx_img_lock);
+  return (newimg);
+}
+
+
+char	*mlx_get_data_addr(mlx_img_list_t *img_ptr, int *bits_per_pixel, int *size_line, int *endian)
+{
+  *bits_per_pixel = UNIQ_BPP*8;
+  *size_line = img_ptr->width*UNIQ_BPP;
+  *endian = 0; // little endian for now on mac-intel
+  return (img_ptr->buffer);
+}
+
+
+int	mlx_destroy_image(mlx_ptr_t *mlx_ptr, mlx_img_list_t *img_todel)
+{
+  mlx_img_list_t	first;
+  mlx_img_list_t	*img;
+
+  pthread_mutex_lock(&mlx_img_lock);
+  first.next = mlx_ptr->img_list;
+  img = &first;
+  while (img && img->next)
+    {
+      if (img->next == img_todel)
+	img->next = img->next->next;
+      img = img->next;
+    }
+  mlx_ptr->img_list = first.next;
+  pthread_mutex_unlock(&mlx_img_lock);
+  free(img_todel->buffer);
+  free(img_todel);
+  return (0);
+}
+
+
+static unsigned int	hl_blend(unsigned int dst, unsigned int src)
+{
+  unsigned int	a;
+  unsigned int	out;
+  unsigned int	c;
+  int		shift;
+
+  a = src >> 24;
+  if (a == 0)
+    return ((dst & 0xFF000000) | (src & 0xFFFFFF));
+  if (a == 0xFF)
+    return (dst);
+  out = dst & 0xFF000000;
+  shift = 0;
+  while (shift < 24)
+    {
+      c = ((src >> shift) & 0xFF) * (255 - a) + ((dst >> shift) & 0xFF) * a + 128;
+      out |= (((c + (c >> 8)) >> 8) & 0xFF) << shift;
+      shift += 8;
+    }
+  return (out);
+}
+
+
+int	mlx_put_image_to_window(mlx_ptr_t *mlx_ptr, mlx_win_list_t *win_ptr, mlx_img_list_t *img_ptr, int x, int y)
+{
+  hl_win_t	*hw;
+  unsigned int	*src;
+  unsigned int	*dst;
+  int		i;
+  int		j;
+
+  (void)mlx_ptr;
+  hw = win_ptr->winid;
+  j = (y < 0 ? -y : 0);
+  while (j < img_ptr->height && y + j < hw->height)
+    {
+      src = (unsigned int *)img_ptr->buffer + j * img_ptr->width;
+      dst = hw->fb + (y + j) * hw->width + x;
+      i = (x < 0 ? -x : 0);
+      while (i < img_ptr->width && x + i < hw->width)
+	{
+	  dst[i] = hl_blend(dst[i], src[i]);
+	  i ++;
+	}
+      j ++;
+    }
+  win_ptr->nb_flush ++;
+  return (0);
+}
+
+
+int	mlx_pixel_put(mlx_ptr_t *mlx_ptr, mlx_win_list_t *win_ptr, int x, int y, int color)
+{
+  hl_win_t	*hw;
+
+  (void)mlx_ptr;
+  hw = win_ptr->winid;
+  if (x < 0 || y < 0 || x >= hw->width || y >= hw->height)
+    return (0);
+  hw->fb[y * hw->width + x] = hl_blend(hw->fb[y * hw->width + x], color);
+  win_ptr->nb_flush ++;
+  return (0);
+}
+
+
+unsigned int	mlx_get_color_value(mlx_ptr_t *mlx_ptr, int color)
+{
+  (void)mlx_ptr;
+  return (color);
+}
+
+
+int	mlx_string_put(mlx_ptr_t *mlx_ptr, mlx_win_list_t *win_ptr, int x, int y, int color, char *string)
+{
+  (void)mlx_ptr;
+  (void)x;
+  (void)y;
+  (void)color;
+  (void)string;
+  win_ptr->nb_flush ++;
+  return (0);
+}
+
+
+// mlx_xpm.c uses strlcpy, which glibc only ships since 2.38
+
+size_t	strlcpy(char *dst, const char *src, size_t size)
+{
+  size_t	len;
+
+  len = strlen(src);
+  if (size)
+    {
+      if (len >= size)
+	size --;
+      else
+	size = len;
+      memcpy(dst, src, size);
+      dst[size] = 0;
+    }
+  return (len);
+}
@@ -0,0 +1,20 @@
+//
+// mlx_headless.h for minilibx
+//
+// in-memory windows: same hooks as MlxWin, a plain 32 bits framebuffer.
+//
+
+#define HL_LINE_MAX	1024
+
+typedef struct	hl_win_s
+{
+  int		width;
+  int		height;
+  unsigned int	*fb;
+  func_t	event_funct[MAX_EVENT];
+  void		*event_param[MAX_EVENT];
+} hl_win_t;
+
+int	mlx_hl_dump(mlx_win_list_t *win, char *file);
+int	mlx_hl_dump_png(hl_win_t *hw, FILE *f);
+void	mlx_hl_event(mlx_win_list_t *win, int event, int a, int b, int c);
@@ -0,0 +1,121 @@
+//
+// mlx_headless_dump.c for minilibx
+//
+// framebuffer snapshots: binary PPM, or an 8 bits RGB PNG through zlib.
+//
+
+#include <OpenGL/gl3.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "zlib.h"
+
+#include "mlx_int.h"
+#include "mlx_headless.h"
+
+
+static void	hl_rgb_rows(hl_win_t *hw, unsigned char *out, int filter)
+{
+  unsigned int	px;
+  int		x;
+  int		y;
+
+  y = 0;
+  while (y < hw->height)
+    {
+      if (filter)
+	*(out ++) = 0;
+      x = 0;
+      while (x < hw->width)
+	{
+	  px = hw->fb[y * hw->width + x];
+	  *(out ++) = (px >> 16) & 0xFF;
+	  *(out ++) = (px >> 8) & 0xFF;
+	  *(out ++) = px & 0xFF;
+	  x ++;
+	}
+      y ++;
+    }
+}
+
+
+static void	hl_png_chunk(FILE *f, char *type, unsigned char *data, unsigned int len)
+{
+  unsigned int	be;
+  uLong		crc;
+
+  be = htonl(len);
+  fwrite(&be, 4, 1, f);
+  fwrite(type, 1, 4, f);
+  if (len)
+    fwrite(data, 1, len, f);
+  crc = crc32(0L, (Bytef *)type, 4);
+  if (len)
+    crc = crc32(crc, data, len);
+  be = htonl((unsigned int)crc);
+  fwrite(&be, 4, 1, f);
+}
+
+
+int	mlx_hl_dump_png(hl_win_t *hw, FILE *f)
+{
+  unsigned char	hdr[13];
+  unsigned char	*raw;
+  unsigned char	*z;
+  uLongf	zlen;
+  uLong		rlen;
+
+  rlen = (uLong)hw->height * (hw->width * 3 + 1);
+  zlen = compressBound(rlen);
+  raw = malloc(rlen);
+  z = malloc(zlen);
+  if (raw == NULL || z == NULL)
+    {
+      free(raw);
+      free(z);
+      return (-1);
+    }
+  hl_rgb_rows(hw, raw, 1);
+  compress2(z, &zlen, raw, rlen, Z_BEST_SPEED);
+  *(unsigned int *)hdr = htonl(hw->width);
+  *(unsigned int *)(hdr + 4) = htonl(hw->height);
+  memcpy(hdr + 8, "\x08\x02\x00\x00\x00", 5);
+  fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+  hl_png_chunk(f, "IHDR", hdr, 13);
+  hl_png_chunk(f, "IDAT", z, zlen);
+  hl_png_chunk(f, "IEND", NULL, 0);
+  free(raw);
+  free(z);
+  return (0);
+}
+
+
+int	mlx_hl_dump(mlx_win_list_t *win, char *file)
+{
+  hl_win_t	*hw;
+  unsigned char	*rgb;
+  FILE		*f;
+  int		len;
+  int		ret;
+
+  hw = win->winid;
+  if ((f = fopen(file, "wb")) == NULL)
+    return (-1);
+  len = strlen(file);
+  if (len > 4 && strcmp(file + len - 4, ".png") == 0)
+    ret = mlx_hl_dump_png(hw, f);
+  else if ((rgb = malloc((size_t)hw->width * hw->height * 3)) == NULL)
+    ret = -1;
+  else
+    {
+      hl_rgb_rows(hw, rgb, 0);
+      fprintf(f, "P6\n%d %d\n255\n", hw->width, hw->height);
+      fwrite(rgb, 3, (size_t)hw->width * hw->height, f);
+      free(rgb);
+      ret = 0;
+    }
+  fclose(f);
+  return (ret);
+}
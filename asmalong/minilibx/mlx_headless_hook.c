@@ -0,0 +1,87 @@
+//
+// mlx_headless_hook.c for minilibx
+//
+// event registration and the no-op window system calls.
+//
+
+#include <OpenGL/gl3.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "mlx_int.h"
+#include "mlx_headless.h"
+
+
+int	mlx_hook(mlx_win_list_t *win_ptr, int x_event, int x_mask, int (*funct_ptr)(), void *param)
+{
+  hl_win_t	*hw;
+
+  (void)x_mask;
+  if (x_event < 0 || x_event >= MAX_EVENT)
+    return (0);
+  hw = win_ptr->winid;
+  hw->event_funct[x_event] = funct_ptr;
+  hw->event_param[x_event] = param;
+  return (0);
+}
+
+int	mlx_expose_hook(mlx_win_list_t *win_ptr, int (*funct_ptr)(), void *param)
+{
+  return (mlx_hook(win_ptr, 12, 0, funct_ptr, param));
+}
+
+int	mlx_key_hook(mlx_win_list_t *win_ptr, int (*funct_ptr)(), void *param)
+{
+  return (mlx_hook(win_ptr, 3, 0, funct_ptr, param));
+}
+
+int	mlx_mouse_hook(mlx_win_list_t *win_ptr, int (*funct_ptr)(), void *param)
+{
+  return (mlx_hook(win_ptr, 4, 0, funct_ptr, param));
+}
+
+
+int	mlx_mouse_hide()
+{
+  return (0);
+}
+
+int	mlx_mouse_show()
+{
+  return (0);
+}
+
+int	mlx_mouse_move(mlx_win_list_t *win_ptr, int x, int y)
+{
+  (void)win_ptr;
+  (void)x;
+  (void)y;
+  return (0);
+}
+
+int	mlx_mouse_get_pos(mlx_win_list_t *win_ptr, int *x, int *y)
+{
+  (void)win_ptr;
+  *x = 0;
+  *y = 0;
+  return (0);
+}
+
+
+int	mlx_do_key_autorepeatoff(mlx_ptr_t *mlx_ptr)
+{
+  (void)mlx_ptr;
+  return (0);
+}
+
+int	mlx_do_key_autorepeaton(mlx_ptr_t *mlx_ptr)
+{
+  (void)mlx_ptr;
+  return (0);
+}
+
+int	mlx_do_sync(mlx_ptr_t *mlx_ptr)
+{
+  (void)mlx_ptr;
+  return (0);
+}
@@ -0,0 +1,147 @@
+//
+// mlx_headless_loop.c for minilibx
+//
+// hooks and the scripted main loop.
+// MLX_SCRIPT names a file of commands, one per line:
+//   key <code|w|a|s|d|esc> [count]   press + release, then one frame
+//   press <code>  release <code>      single key events
+//   click <button> <x> <y>            mouse button press
+//   frame [count]                     run the loop hook
+//   expose  close                     expose / destroy notify hooks
+//   dump <file.ppm|file.png>          write the window framebuffer
+// without a script the loop hook runs MLX_FRAMES times (default 1).
+// MLX_STATS prints the frame and flush counters on stderr at the end.
+//
+
+#include <OpenGL/gl3.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mlx_int.h"
+#include "mlx_headless.h"
+
+
+static int	hl_frames = 0;
+
+
+static int	hl_key_code(char *name)
+{
+  static char	*names[] = {"a", "s", "d", "w", "esc", NULL};
+  static int	codes[] = {0, 1, 2, 13, 53};
+  int		i;
+
+  i = 0;
+  while (names[i])
+    {
+      if (strcmp(names[i], name) == 0)
+	return (codes[i]);
+      i ++;
+    }
+  return (atoi(name));
+}
+
+
+void	mlx_hl_event(mlx_win_list_t *win, int event, int a, int b, int c)
+{
+  hl_win_t	*hw;
+  func_t	f;
+  void		*param;
+
+  if (win == NULL || event < 0 || event >= MAX_EVENT)
+    return ;
+  hw = win->winid;
+  f = hw->event_funct[event];
+  param = hw->event_param[event];
+  if (f == NULL)
+    return ;
+  if (event == 2 || event == 3)
+    f(a, param);
+  else if (event == 4 || event == 5)
+    f(a, b, c, param);
+  else if (event == 6)
+    f(b, c, param);
+  else
+    f(param);
+}
+
+
+static void	hl_frame(mlx_ptr_t *mlx_ptr, int count)
+{
+  while (count-- > 0)
+    {
+      if (mlx_ptr->loop_hook)
+	mlx_ptr->loop_hook(mlx_ptr->loop_hook_data);
+      hl_frames ++;
+    }
+}
+
+
+static void	hl_command(mlx_ptr_t *mlx_ptr, char *cmd, char *arg, int n[3])
+{
+  mlx_win_list_t	*win;
+  int			count;
+
+  win = mlx_ptr->win_list;
+  count = (n[0] > 0 ? n[0] : 1);
+  if (strcmp(cmd, "key") == 0)
+    while (count-- > 0)
+      {
+	mlx_hl_event(win, 2, hl_key_code(arg), 0, 0);
+	mlx_hl_event(win, 3, hl_key_code(arg), 0, 0);
+	hl_frame(mlx_ptr, 1);
+      }
+  else if (strcmp(cmd, "press") == 0 || strcmp(cmd, "release") == 0)
+    mlx_hl_event(win, (cmd[0] == 'p' ? 2 : 3), hl_key_code(arg), 0, 0);
+  else if (strcmp(cmd, "click") == 0)
+    mlx_hl_event(win, 4, atoi(arg), n[0], n[1]);
+  else if (strcmp(cmd, "frame") == 0)
+    hl_frame(mlx_ptr, (arg[0] ? atoi(arg) : 1));
+  else if (strcmp(cmd, "expose") == 0)
+    mlx_hl_event(win, 12, 0, 0, 0);
+  else if (strcmp(cmd, "close") == 0)
+    mlx_hl_event(win, 17, 0, 0, 0);
+  else if (strcmp(cmd, "dump") == 0 && win)
+    mlx_hl_dump(win, arg);
+}
+
+
+int	mlx_loop(mlx_ptr_t *mlx_ptr)
+{
+  FILE	*f;
+  char	line[HL_LINE_MAX];
+  char	cmd[HL_LINE_MAX];
+  char	arg[HL_LINE_MAX];
+  int	n[3];
+
+  mlx_ptr->main_loop_active = 1;
+  if (getenv("MLX_SCRIPT") == NULL ||
+      (f = fopen(getenv("MLX_SCRIPT"), "r")) == NULL)
+    hl_frame(mlx_ptr, (getenv("MLX_FRAMES") ? atoi(getenv("MLX_FRAMES")) : 1));
+  else
+    {
+      while (fgets(line, sizeof(line), f))
+	{
+	  arg[0] = 0;
+	  n[0] = 0;
+	  n[1] = 0;
+	  if (line[0] != '#' &&
+	      sscanf(line, "%s %s %d %d", cmd, arg, n, n + 1) >= 1)
+	    hl_command(mlx_ptr, cmd, arg, n);
+	}
+      fclose(f);
+    }
+  if (getenv("MLX_STATS") && mlx_ptr->win_list)
+    fprintf(stderr, "mlx: %d frames, %d flushes\n", hl_frames,
+	    mlx_ptr->win_list->nb_flush);
+  mlx_ptr->main_loop_active = 0;
+  return (0);
+}
+
+
+int	mlx_loop_hook(mlx_ptr_t *mlx_ptr, void (*fct)(void *), void *param)
+{
+  mlx_ptr->loop_hook = fct;
+  mlx_ptr->loop_hook_data = param;
+  return (0);
+}
@@ -7,10 +7,17 @@
 #import <Cocoa/Cocoa.h>
 #import <OpenGL/gl3.h>
 
+#include <pthread.h>
+
 #include "mlx_int.h"
 #include "mlx_new_window.h"
 
 
+// images may be decoded on worker threads (xpm/png loaders): only the
+// shared image list needs the lock, GL textures are made on first put.
+static pthread_mutex_t	mlx_img_lock = PTHREAD_MUTEX_INITIALIZER;
+
+
 
 void    *mlx_new_image(mlx_ptr_t *mlx_ptr, int width, int height)
 {
@@ -20,8 +27,10 @@ void    *mlx_new_image(mlx_ptr_t *mlx_ptr, int width, int height)
   //    return (NULL);  // need at leat one window created to have openGL context and create texture
   if ((newimg = malloc(sizeof(*newimg))) == NULL)
     return ((void *)0);
+  pthread_mutex_lock(&mlx_img_lock);
   newimg->next = mlx_ptr->img_list;
   mlx_ptr->img_list = newimg;
+  pthread_mutex_unlock(&mlx_img_lock);
   newimg->width = width;
   newimg->height = height;
   newimg->vertexes[0] = 0.0;  newimg->vertexes[1] = 0.0;
@@ -156,6 +165,7 @@ int     mlx_destroy_image(mlx_ptr_t *mlx_ptr, mlx_img_list_t *img_todel)
   mlx_img_list_t *img;
   mlx_win_list_t *win;
 
+  pthread_mutex_lock(&mlx_img_lock);
   img_first.next = mlx_ptr->img_list;
   img = &img_first;
   while (img && img->next)
@@ -165,6 +175,7 @@ int     mlx_destroy_image(mlx_ptr_t *mlx_ptr, mlx_img_list_t *img_todel)
       img = img->next;
     }
   mlx_ptr->img_list = img_first.next;
+  pthread_mutex_unlock(&mlx_img_lock);
 
 
   win = mlx_ptr->win_list;
@@ -0,0 +1,32 @@
+//
+// mlx_png_filter.h for minilibx
+//
+// scanline level PNG helpers and the streaming decoder state.
+//
+
+typedef struct png_info_s
+{
+  unsigned int	width;
+  unsigned int	height;
+  int		depth;
+  int		color;
+  int		interlace;
+  int		bpp;
+} png_info_t;
+
+// inflate target: the scanline being filled and the one above it
+typedef struct png_stream_s
+{
+  unsigned char	*rows;
+  unsigned char	*cur;
+  unsigned char	*prev;
+  int		stride;
+  int		fill;
+  int		pass;
+  unsigned int	pw;
+  unsigned int	ph;
+  unsigned int	y;
+} png_stream_t;
+
+void	mipng_unfilter_row(int filter, unsigned char *cur, unsigned char *prev, int len, int bpp);
+void	mipng_put_row(unsigned int *dst, int dx, unsigned char *raw, int width, png_info_t *pi);
@@ -14,6 +14,7 @@ typedef struct  s_xpm_col
 {
   int           name;
   int           col;
+  int           used;
 } t_xpm_col;
 
 
@@ -89,6 +90,9 @@ int	mlx_int_get_col_name(char *str,int size)
 int	mlx_int_get_text_rgb(char *name, char *end)
 {
   int	i;
+  int	lo;
+  int	hi;
+  int	cmp;
   char	buff[64];
 
   if (*name == '#')
@@ -98,12 +102,54 @@ int	mlx_int_get_text_rgb(char *name, char *end)
       snprintf(buff, 64, "%s %s", name, end);
       name = buff;
     }
-  i = 0;
-  while (mlx_col_name[i].name)
+  lo = 0;
+  hi = sizeof(mlx_col_name)/sizeof(*mlx_col_name) - 1;
+  while (lo < hi)
     {
-      if (!strcasecmp(mlx_col_name[i].name, name))
+      i = (lo + hi) / 2;
+      if ((cmp = strcasecmp(mlx_col_name[i].name, name)) == 0)
 	return (mlx_col_name[i].color);
-      i ++;
+      if (cmp < 0)
+	lo = i + 1;
+      else
+	hi = i;
+    }
+  return (0);
+}
+
+
+// cpp > 2: open addressing on the packed color name, size a power of 2
+// at least twice nc. The first definition of a name wins, as before.
+
+int	mlx_int_xpm_hash(int name, int mask)
+{
+  return ((int)(((unsigned int)name * 0x9E3779B1u) >> 7) & mask);
+}
+
+void	mlx_int_xpm_col_add(t_xpm_col *colors, int mask, int name, int col)
+{
+  int	h;
+
+  h = mlx_int_xpm_hash(name, mask);
+  while (colors[h].used && colors[h].name != name)
+    h = (h + 1) & mask;
+  if (colors[h].used)
+    return ;
+  colors[h].used = 1;
+  colors[h].name = name;
+  colors[h].col = col;
+}
+
+int	mlx_int_xpm_col_get(t_xpm_col *colors, int mask, int name)
+{
+  int	h;
+
+  h = mlx_int_xpm_hash(name, mask);
+  while (colors[h].used)
+    {
+      if (colors[h].name == name)
+	return (colors[h].col);
+      h = (h + 1) & mask;
     }
   return (0);
 }
@@ -151,6 +197,9 @@ void	*mlx_int_parse_xpm(mlx_ptr_t *xvar,void *info,int info_size,char *(*f)())
   int		*colors_direct;
   int	width;
   int	height;
+  int	mask = 0;
+  int	last_name;
+  int	last_col;
 
   colors = 0;
   colors_direct = 0;
@@ -173,13 +222,19 @@ void	*mlx_int_parse_xpm(mlx_ptr_t *xvar,void *info,int info_size,char *(*f)())
 	RETURN;
     }
   else
-    if (!(colors = malloc(nc*sizeof(*colors))))
-      RETURN;
+    {
+      mask = 1;
+      while (mask < 2*nc)
+	mask <<= 1;
+      if (!(colors = calloc(mask, sizeof(*colors))))
+	RETURN;
+      mask --;
+    }
 
   clip_data = 0;
 
-  i = nc;
-  while (i--)
+  i = 0;
+  while (i++ < nc)
     {
       if (!(line = f(info,&pos,info_size)) ||
 	  !(tab = mlx_int_str_to_wordtab(line+cpp)) )
@@ -206,10 +261,7 @@ void	*mlx_int_parse_xpm(mlx_ptr_t *xvar,void *info,int info_size,char *(*f)())
 	colors_direct[mlx_int_get_col_name(line,cpp)] = rgb_col;
       //	  rgb_col>=0?mlx_get_color_value(xvar, rgb_col):rgb_col;
       else
-	{
-	  colors[i].name = mlx_int_get_col_name(line,cpp);
-	  colors[i].col = rgb_col; // rgb_col>=0?mlx_get_color_value(xvar,rgb_col):rgb_col;
-	}
+	mlx_int_xpm_col_add(colors, mask, mlx_int_get_col_name(line,cpp), rgb_col);
       free(tab);
       tab = 0;
     }
@@ -222,6 +274,10 @@ void	*mlx_int_parse_xpm(mlx_ptr_t *xvar,void *info,int info_size,char *(*f)())
 
   i = height;
   data = img->buffer;
+  last_name = 0;
+  last_col = 0;
+  if (!method)
+    last_col = mlx_int_xpm_col_get(colors, mask, 0);
   while (i--)
     {
       if (!(line = f(info,&pos,info_size)))
@@ -235,13 +291,12 @@ void	*mlx_int_parse_xpm(mlx_ptr_t *xvar,void *info,int info_size,char *(*f)())
 	    col = colors_direct[col_name];
 	  else
 	    {
-	      j = nc;
-	      while (j--)
-		if (colors[j].name==col_name)
-		  {
-		    col = colors[j].col;
-		    j = 0;
-		  }
+	      if (col_name != last_name)
+		{
+		  last_name = col_name;
+		  last_col = mlx_int_xpm_col_get(colors, mask, col_name);
+		}
+	      col = last_col;
 	    }
 	  //	  if (col==-1)
 	  //	    XPutPixel(clip_img, x, height-1-i, 0);
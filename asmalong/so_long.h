@@ -6,7 +6,7 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/18 12:04:10 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/04/29 10:42:02 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/07/16 10:21:37 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,14 @@
 # include "ft_printf/ft_printf.h"
 # include "minilibx/mlx.h"
 # include <fcntl.h>
+# include <limits.h>
+# include <pthread.h>
+# include <time.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
 
 # define SPACE		"img/space.xpm"
 # define WALL		"img/wall.xpm"
@@ -24,6 +32,45 @@
 # define COIN		"img/coin.xpm"
 # define EXIT		"img/exit.xpm"
 
+# define ASSETS		5
+# define ASSET_THREADS	4
+
+# define TILE		100
+# define STAGE		200
+
+typedef struct s_img
+{
+	void			*ptr;
+	unsigned int	*px;
+	int				line;
+	int				w;
+	int				h;
+}	t_img;
+
+# define CELL_BAD		0
+# define CELL_SPACE		1
+# define CELL_WALL		2
+# define CELL_COIN		3
+# define CELL_PLAYER	4
+# define CELL_EXIT		5
+# define CELL_TYPES		6
+
+typedef struct s_scan
+{
+	unsigned char	class[256];
+	int				count[CELL_TYPES];
+	int				horiz;
+	int				vert;
+}	t_scan;
+
+typedef struct s_fill
+{
+	unsigned long	*seen;
+	int				*stack;
+	int				top;
+	int				cap;
+}	t_fill;
+
 typedef struct s_game
 {
 	int		w;
@@ -31,7 +78,6 @@ typedef struct s_game
 	char	**map;
 	int		collectible;
 	int		flag;
-	char	hash_map[256][256];
 	int		find_e;
 	int		find_c;
 	int		p_pos_x;
@@ -39,36 +85,55 @@ typedef struct s_game
 	int		steps;
 	void	*mlx;
 	void	*mlx_win;
-	void	*img;
+	t_img	space;
+	t_img	wall;
+	t_img	player;
+	t_img	coin;
+	t_img	exit;
+	t_img	frame;
+	t_img	stage;
+	int		dirty[4];
+	long	t_start;
+	long	t_assets;
 }	t_game;
 
+typedef struct s_assets
+{
+	t_game			*game;
+	t_img			*img[ASSETS];
+	char			*path[ASSETS];
+	int				next;
+	pthread_mutex_t	lock;
+}	t_assets;
+
 void	ft_error(char *string);
-void	temp_map_error(char *tempmap, char *string);
 void	map_error(t_game *game, char *string);
 
-char	*get_next_line(int fd);
-int		gnl_strlen(char *s);
-char	*gnl_strchr(char *s);
-char	*gnl_strdup(char *remainder);
-char	*gnl_strjoin(char *old, char *new);
-
 void	ft_parsing(t_game *game, char *file);
 void	ft_check_file_extension(char *file);
-char	*ft_read_map(char *file);
-void	ft_check_map(t_game *game, char *read_map);
-void	check_walls(t_game *game);
-void	game_elements(t_game *game);
-int		count_game_elem(t_game *game, char c);
-void	check_map_chars(t_game *game);
+void	ft_read_map(t_game *game, char *file);
+void	check_map(t_game *game);
 
 void	rendering_map(t_game *game);
 void	rendering_win(t_game *game);
 void	locate_items_and_put_img(t_game *game, char c, int x, int y);
-void	rendering_img(t_game *game, char *path, int x, int y);
+void	rendering_img(t_game *game, t_img *img, int x, int y);
+void	load_textures(t_game *game);
+void	upload_texture(t_game *game, t_img *img);
+void	destroy_textures(t_game *game);
+long	clock_us(void);
+void	report_startup(t_game *game);
+
+void	frame_init(t_game *game);
+void	frame_mark(t_game *game, int x, int y);
+int		present_frame(t_game *game);
+void	blit_img(t_img *frame, t_img *img, int x, int y);
+int		blend_wide(unsigned int *dst, unsigned int *src, int n);
+unsigned int	blend_px(unsigned int dst, unsigned int src);
 
 void	valid_exitpass(t_game *game);
-void	scanning_map(t_game *game, int x, int y);
-int		scan_exitpass(t_game *game, int x, int y);
+int		fill_push(t_fill *fill, int i);
+void	fill_span(t_game *game, t_fill *fill, int seed);
 
 int		player_moves(int key, t_game *game);
 void	next_move(t_game *game, int x, int y);
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   blend_test.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/07/16 10:21:37 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/07/16 14:02:55 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../so_long.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define ROUNDS		400
+#define BENCH_RUNS	500
+
+static const int	g_alpha[4] = {0, 255, 256, 128};
+static unsigned int	g_rand = 42;
+
+static unsigned int	rnd(unsigned int alpha)
+{
+	g_rand ^= g_rand << 13;
+	g_rand ^= g_rand >> 17;
+	g_rand ^= g_rand << 5;
+	if (alpha > 255)
+		return (g_rand);
+	return ((g_rand & 0x00FFFFFF) | alpha << 24);
+}
+
+static char	*check_row(unsigned int *dst, unsigned int *src, int n, int alpha)
+{
+	unsigned int	want[STAGE];
+	int				i;
+
+	i = -1;
+	while (++i < n)
+	{
+		src[i] = rnd(alpha);
+		dst[i] = rnd(256);
+		want[i] = blend_px(dst[i], src[i]);
+		if ((want[i] & 0xFF000000) != (dst[i] & 0xFF000000)
+			|| (alpha == 0 && (want[i] ^ src[i]) & 0x00FFFFFF)
+			|| (alpha == 255 && (want[i] ^ dst[i]) & 0x00FFFFFF))
+			return ("blend_px: wrong pixel");
+	}
+	i = blend_wide(dst, src, n);
+	if (i % 4 || i > n)
+		return ("blend_wide: bad count");
+	while (i < n)
+	{
+		dst[i] = blend_px(dst[i], src[i]);
+		i++;
+	}
+	if (memcmp(dst, want, n * sizeof(unsigned int)))
+		return ("blend_wide: differs from blend_px");
+	return (NULL);
+}
+
+static double	bench(t_img *dst, t_img *src, int wide)
+{
+	struct timespec	t[2];
+	unsigned int	*d;
+	unsigned int	*s;
+	int				k;
+	int				i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t[0]);
+	k = -1;
+	while (++k < BENCH_RUNS * STAGE)
+	{
+		d = dst->px + k % STAGE * dst->line;
+		s = src->px + k % STAGE * src->line;
+		i = 0;
+		if (wide)
+			i = blend_wide(d, s, STAGE);
+		while (i < STAGE)
+		{
+			d[i] = blend_px(d[i], s[i]);
+			i++;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t[1]);
+	return (((t[1].tv_sec - t[0].tv_sec) * 1e9 + t[1].tv_nsec - t[0].tv_nsec)
+		/ BENCH_RUNS / 1e3);
+}
+
+static int	stage_image(void *mlx, t_img *img)
+{
+	int	bpp;
+	int	line;
+	int	endian;
+	int	i;
+
+	img->ptr = mlx_new_image(mlx, STAGE, STAGE);
+	if (img->ptr == NULL)
+		return (0);
+	img->px = (unsigned int *)mlx_get_data_addr(img->ptr, &bpp, &line,
+			&endian);
+	img->line = line / 4;
+	img->w = STAGE;
+	img->h = STAGE;
+	i = -1;
+	while (++i < STAGE * img->line)
+		img->px[i] = rnd(256);
+	return (1);
+}
+
+static int	check_all(t_img *img)
+{
+	char	*err;
+	int		round;
+
+	err = NULL;
+	round = -1;
+	while (err == NULL && ++round < ROUNDS)
+		err = check_row(img[0].px, img[1].px, 1 + round % STAGE,
+				g_alpha[round % 4]);
+	if (err != NULL)
+		fprintf(stderr, "%s: n %d alpha %d\n", err, 1 + round % STAGE,
+			g_alpha[round % 4]);
+	return (err == NULL);
+}
+
+int	main(void)
+{
+	void	*mlx;
+	t_img	img[2];
+	double	us[2];
+
+	mlx = mlx_init();
+	if (mlx == NULL || !stage_image(mlx, &img[0])
+		|| !stage_image(mlx, &img[1]) || !check_all(img))
+		return (1);
+	us[0] = bench(&img[0], &img[1], 0);
+	us[1] = bench(&img[0], &img[1], 1);
+	printf("blend: %d rows ok; %dx%d stage: blend_px %.1f us, "
+		"blend_wide %.1f us (x%.2f)\n", ROUNDS, STAGE, STAGE, us[0], us[1],
+		us[0] / us[1]);
+	mlx_destroy_image(mlx, img[0].ptr);
+	mlx_destroy_image(mlx, img[1].ptr);
+	return (0);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 17:40:21 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/04 17:40:21 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static void	beam_free(t_beam *beam)
+{
+	free(beam->cur);
+	free(beam->cand);
+	free(beam->trail);
+	free(beam->keys);
+	free(beam->vals);
+}
+
+static int	beam_init(t_beam *beam, t_list *node)
+{
+	ft_bzero(beam, sizeof(t_beam));
+	beam->cur = malloc(sizeof(t_bnode) * BEAM_WIDTH);
+	beam->cand = malloc(sizeof(t_bnode) * BEAM_WIDTH * 11);
+	beam->trail = malloc(sizeof(int) * BEAM_WIDTH * BEAM_DEPTH);
+	beam->keys = ft_calloc(BEAM_TT, sizeof(uint64_t));
+	beam->vals = ft_calloc(BEAM_TT, sizeof(uint64_t));
+	if (!beam->cur || !beam->cand || !beam->trail || !beam->keys
+		|| !beam->vals)
+	{
+		beam_free(beam);
+		return (0);
+	}
+	while (node != NULL)
+	{
+		beam->cur[0].s[beam->n++] = node->index - 1;
+		node = node->next;
+	}
+	beam->cur[0].la = beam->n;
+	beam->count = 1;
+	beam->cur[0].key = beam_hash(&beam->cur[0], beam->n);
+	beam->keys[beam->cur[0].key & (BEAM_TT - 1)] = beam->cur[0].key;
+	beam->vals[beam->cur[0].key & (BEAM_TT - 1)] = 1;
+	return (1);
+}
+
+int	sort_beam(t_ps *ps)
+{
+	t_beam			beam;
+	t_worker		workers[BEAM_THREADS];
+	unsigned char	ops[BEAM_DEPTH];
+	int				len;
+	int				i;
+
+	if (!beam_init(&beam, ps->a.top))
+		return (0);
+	len = 0;
+	if (pool_start(&beam, workers))
+	{
+		len = beam_search(&beam, ops);
+		pool_stop(&beam, workers, BEAM_THREADS);
+	}
+	beam_free(&beam);
+	i = -1;
+	while (++i < len)
+		apply_op(ps, ops[i]);
+	return (len > 0);
+}
+
+//Beam search for stacks of SMALL_MAX + 1 to BEAM_MAX elements: every round
+//keeps the BEAM_WIDTH best states by beam_score. Returns 0 (and prints
+//nothing) when no sorted state is reached within BEAM_DEPTH moves.
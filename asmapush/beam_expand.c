@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 16:58:03 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/26 09:41:18 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+void	beam_expand(t_beam *beam, int id)
+{
+	t_bnode	*child;
+	int		i;
+	int		end;
+	int		op;
+
+	i = beam->count * id / BEAM_THREADS - 1;
+	end = beam->count * (id + 1) / BEAM_THREADS;
+	while (++i < end)
+	{
+		op = -1;
+		while (++op < 11)
+		{
+			child = &beam->cand[i * 11 + op];
+			*child = beam->cur[i];
+			child->h = BEAM_HMAX + 1;
+			if ((beam->depth > 0 && op_inverse(child->op) == op)
+				|| !beam_apply(child, beam->n, op))
+				continue ;
+			child->key = beam_hash(child, beam->n);
+			child->slot = tt_claim(beam, child->key, i * 11 + op);
+			if (child->slot >= 0)
+				beam_score(child, beam->n);
+		}
+	}
+}
+
+//Children of cur[i] go to cand[i * 11 + op]; a slot keeps h > BEAM_HMAX when
+//the move is illegal, undoes the previous one or reaches a known state.
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam_pool.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 17:15:30 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/04 17:15:34 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static void	finish(t_beam *beam)
+{
+	pthread_mutex_lock(&beam->lock);
+	if (--beam->pending == 0)
+		pthread_cond_signal(&beam->done);
+	pthread_mutex_unlock(&beam->lock);
+}
+
+static void	*worker(void *arg)
+{
+	t_worker	*w;
+	int			seen;
+
+	w = (t_worker *)arg;
+	seen = 0;
+	while (1)
+	{
+		pthread_mutex_lock(&w->beam->lock);
+		while (w->beam->round == seen && !w->beam->stop)
+			pthread_cond_wait(&w->beam->go, &w->beam->lock);
+		seen = w->beam->round;
+		if (w->beam->stop)
+		{
+			pthread_mutex_unlock(&w->beam->lock);
+			return (NULL);
+		}
+		pthread_mutex_unlock(&w->beam->lock);
+		beam_expand(w->beam, w->id);
+		finish(w->beam);
+	}
+}
+
+int	pool_start(t_beam *beam, t_worker *workers)
+{
+	int	i;
+
+	pthread_mutex_init(&beam->lock, NULL);
+	pthread_cond_init(&beam->go, NULL);
+	pthread_cond_init(&beam->done, NULL);
+	beam->round = 0;
+	beam->stop = 0;
+	i = -1;
+	while (++i < BEAM_THREADS)
+	{
+		workers[i].beam = beam;
+		workers[i].id = i;
+		if (pthread_create(&workers[i].thread, NULL, worker, &workers[i]))
+		{
+			pool_stop(beam, workers, i);
+			return (0);
+		}
+	}
+	return (1);
+}
+
+void	pool_round(t_beam *beam)
+{
+	pthread_mutex_lock(&beam->lock);
+	beam->pending = BEAM_THREADS;
+	beam->round++;
+	pthread_cond_broadcast(&beam->go);
+	while (beam->pending > 0)
+		pthread_cond_wait(&beam->done, &beam->lock);
+	pthread_mutex_unlock(&beam->lock);
+}
+
+void	pool_stop(t_beam *beam, t_worker *workers, int count)
+{
+	int	i;
+
+	pthread_mutex_lock(&beam->lock);
+	beam->stop = 1;
+	pthread_cond_broadcast(&beam->go);
+	pthread_mutex_unlock(&beam->lock);
+	i = -1;
+	while (++i < count)
+		pthread_join(workers[i].thread, NULL);
+	pthread_mutex_destroy(&beam->lock);
+	pthread_cond_destroy(&beam->go);
+	pthread_cond_destroy(&beam->done);
+}
+
+//The workers live for the whole search: each round pool_round wakes them,
+//worker i expands its slice of the beam into cand[parent * 11 + op], and the
+//main thread waits until all slices are done before selecting.
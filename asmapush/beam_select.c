@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam_select.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 18:05:47 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/04 18:05:47 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	histogram(t_beam *beam, int *hist)
+{
+	t_bnode	*node;
+	int		slot;
+	int		goal;
+
+	goal = -1;
+	slot = -1;
+	while (++slot < beam->count * 11)
+	{
+		node = &beam->cand[slot];
+		if (node->h > BEAM_HMAX || !tt_owner(beam, node, slot))
+		{
+			node->h = BEAM_HMAX + 1;
+			continue ;
+		}
+		if (node->h == 0 && goal < 0)
+			goal = slot;
+		hist[node->h]++;
+	}
+	return (goal);
+}
+
+static int	cutoff(int *hist, int *left)
+{
+	int	cut;
+
+	cut = 0;
+	*left = BEAM_WIDTH;
+	while (cut < BEAM_HMAX && *left > hist[cut])
+		*left -= hist[cut++];
+	return (cut);
+}
+
+int	beam_select(t_beam *beam)
+{
+	int	hist[BEAM_HMAX + 1];
+	int	cut;
+	int	left;
+	int	slot;
+	int	total;
+
+	ft_bzero(hist, sizeof(hist));
+	slot = histogram(beam, hist);
+	if (slot >= 0)
+		return (slot);
+	cut = cutoff(hist, &left);
+	total = beam->count * 11;
+	beam->count = 0;
+	while (++slot < total && beam->count < BEAM_WIDTH)
+	{
+		if (beam->cand[slot].h > cut || (beam->cand[slot].h == cut
+				&& left-- <= 0))
+			continue ;
+		beam->trail[(beam->depth + 1) * BEAM_WIDTH + beam->count] = slot;
+		beam->cur[beam->count++] = beam->cand[slot];
+	}
+	beam->depth++;
+	return (-1);
+}
+
+static int	reconstruct(t_beam *beam, int goal, unsigned char *ops)
+{
+	int	depth;
+	int	slot;
+
+	depth = beam->depth + 1;
+	slot = goal;
+	while (depth > 0)
+	{
+		ops[depth - 1] = slot % 11;
+		depth--;
+		if (depth > 0)
+			slot = beam->trail[depth * BEAM_WIDTH + slot / 11];
+	}
+	return (beam->depth + 1);
+}
+
+int	beam_search(t_beam *beam, unsigned char *ops)
+{
+	int	goal;
+
+	while (beam->depth < BEAM_DEPTH - 1 && beam->count > 0)
+	{
+		pool_round(beam);
+		goal = beam_select(beam);
+		if (goal >= 0)
+			return (reconstruct(beam, goal, ops));
+	}
+	return (0);
+}
+
+//beam_select buckets the surviving candidates by score (scores are small
+//integers, so no sort is needed), takes whole buckets from the best one down
+//and the first `left` states of the last bucket, in slot order.
+//trail[depth][i] remembers which candidate slot became cur[i], so the
+//winning sequence is read back from the goal to the root.
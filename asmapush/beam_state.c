@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam_state.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 16:02:11 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/04 16:02:14 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static void	rot(unsigned char *s, int len, int up)
+{
+	unsigned char	t;
+
+	if (len < 2)
+		return ;
+	if (up)
+	{
+		t = s[0];
+		ft_memmove(s, s + 1, len - 1);
+		s[len - 1] = t;
+		return ;
+	}
+	t = s[len - 1];
+	ft_memmove(s + 1, s, len - 1);
+	s[0] = t;
+}
+
+static int	applicable(int op, int la, int lb)
+{
+	if ((op == OP_SA || op == OP_SS || op == OP_RA || op == OP_RR
+			|| op == OP_RRA || op == OP_RRR) && la < 2)
+		return (0);
+	if ((op == OP_SB || op == OP_SS || op == OP_RB || op == OP_RR
+			|| op == OP_RRB || op == OP_RRR) && lb < 2)
+		return (0);
+	if ((op == OP_PA && lb < 1) || (op == OP_PB && la < 1))
+		return (0);
+	return (1);
+}
+
+int	beam_apply(t_bnode *node, int n, int op)
+{
+	unsigned char	*s;
+	int				la;
+
+	s = node->s;
+	la = node->la;
+	if (!applicable(op, la, n - la))
+		return (0);
+	if (op == OP_SA || op == OP_SS)
+		rot(s, 2, 1);
+	if (op == OP_SB || op == OP_SS)
+		rot(s + la, 2, 1);
+	if (op == OP_PA)
+		rot(s, ++node->la, 0);
+	if (op == OP_PB)
+		rot(s, node->la--, 1);
+	if (op == OP_RA || op == OP_RR || op == OP_RRA || op == OP_RRR)
+		rot(s, la, op < OP_RRA);
+	if (op == OP_RB || op == OP_RR || op == OP_RRB || op == OP_RRR)
+		rot(s + la, n - la, op < OP_RRA);
+	node->op = op;
+	return (1);
+}
+
+static int	cyclic_breaks(unsigned char *s, int len, int ascending)
+{
+	int	i;
+	int	breaks;
+
+	breaks = 0;
+	i = -1;
+	while (++i < len)
+		if ((s[(i + 1) % len] < s[i]) == ascending)
+			breaks++;
+	if (breaks > 0)
+		breaks--;
+	return (breaks);
+}
+
+void	beam_score(t_bnode *node, int n)
+{
+	int	i;
+	int	h;
+
+	h = n - node->la;
+	h += 3 * cyclic_breaks(node->s, node->la, 1);
+	h += cyclic_breaks(node->s + node->la, n - node->la, 0);
+	i = 0;
+	while (++i < node->la)
+		if (node->s[i] != node->s[i - 1] + 1)
+			h++;
+	if (h > BEAM_HMAX)
+		h = BEAM_HMAX;
+	node->h = h;
+}
+
+//The whole state is one byte array: A from s[0] to s[la - 1], then B, so
+//pa/pb are a single rotation of the prefix and every move is a memmove.
+//beam_score is 0 only for a sorted A with an empty B. It adds the elements
+//still in B, the descents of A and ascents of B read as cycles (a rotated
+//run costs nothing there), and the gaps between neighbours in A.
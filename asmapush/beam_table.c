@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   beam_table.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/04 16:40:52 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/04 16:40:55 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	tt_find(t_beam *beam, uint64_t key)
+{
+	uint64_t	expected;
+	int			slot;
+	int			probe;
+
+	slot = key & (BEAM_TT - 1);
+	probe = 0;
+	while (probe++ < 64)
+	{
+		expected = __atomic_load_n(&beam->keys[slot], __ATOMIC_ACQUIRE);
+		if (expected == 0 && __atomic_compare_exchange_n(&beam->keys[slot],
+				&expected, key, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return (slot);
+		if (expected == key)
+			return (slot);
+		slot = (slot + 1) & (BEAM_TT - 1);
+	}
+	return (-1);
+}
+
+int	tt_claim(t_beam *beam, uint64_t key, int id)
+{
+	uint64_t	old;
+	uint64_t	mine;
+	int			slot;
+
+	slot = tt_find(beam, key);
+	if (slot < 0)
+		return (-1);
+	mine = ((uint64_t)beam->depth + 1) << 32 | (uint64_t)(id + 1);
+	old = __atomic_load_n(&beam->vals[slot], __ATOMIC_ACQUIRE);
+	while (1)
+	{
+		if (old != 0 && (old >> 32) <= (uint64_t)beam->depth)
+			return (-1);
+		if (old != 0 && old <= mine)
+			return (-1);
+		if (__atomic_compare_exchange_n(&beam->vals[slot], &old, mine, 0,
+				__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return (slot);
+	}
+}
+
+int	tt_owner(t_beam *beam, t_bnode *node, int id)
+{
+	uint64_t	mine;
+
+	mine = ((uint64_t)beam->depth + 1) << 32 | (uint64_t)(id + 1);
+	return (__atomic_load_n(&beam->vals[node->slot], __ATOMIC_ACQUIRE) == mine);
+}
+
+uint64_t	beam_hash(t_bnode *node, int n)
+{
+	uint64_t	k;
+	int			i;
+
+	k = node->la + 0x9e3779b97f4a7c15ULL;
+	i = -1;
+	while (++i < n)
+	{
+		k ^= node->s[i] + 1;
+		k *= 0xff51afd7ed558ccdULL;
+		k ^= k >> 29;
+	}
+	if (k == 0)
+		k = 1;
+	return (k);
+}
+
+//beam_hash mixes the rank bytes and the size of A into a 64-bit key.
+//Lock-free transposition table shared by the workers. keys[] is claimed with
+//a CAS on the empty slot; vals[] holds (generation << 32 | candidate + 1).
+//A state already reached in an earlier generation is pruned; inside one
+//generation the lowest candidate id wins, so the search stays deterministic
+//no matter how the threads interleave.
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   checker.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/09 16:20:37 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/28 10:14:06 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	ring_sorted(t_ring *a, t_ring *b)
+{
+	int	i;
+	int	cur;
+	int	next;
+
+	if (b->size != 0)
+		return (0);
+	i = 0;
+	cur = a->head;
+	while (++i < a->size)
+	{
+		next = cur + 1;
+		if (next == a->cap)
+			next = 0;
+		if (a->buf[cur] > a->buf[next])
+			return (0);
+		cur = next;
+	}
+	return (1);
+}
+
+static void	finish(t_ring *a, t_ring *b, int ok)
+{
+	if (ok)
+		ok = 1 + ring_sorted(a, b);
+	free(a->buf);
+	free(b->buf);
+	if (!ok)
+		error_exit(NULL);
+	if (ok == 2)
+		ft_putstr_fd("OK\n", 1);
+	else
+		ft_putstr_fd("KO\n", 1);
+}
+
+int	main(int ac, char **av)
+{
+	t_ring	a;
+	t_ring	b;
+	int		*values;
+	int		count;
+	int		ok;
+
+	if (ac == 1)
+		return (0);
+	if (ft_strncmp(av[1], "-", 2) == 0)
+		values = NULL;
+	else
+		values = input_values(av, &count);
+	ok = (values != NULL && !has_duplicates(values, count));
+	a.buf = NULL;
+	b.buf = NULL;
+	if (ok)
+		ok = (ring_init(&a, count, values, count)
+				&& ring_init(&b, count, NULL, 0) && read_ops(&a, &b));
+	free(values);
+	finish(&a, &b, ok);
+	return (0);
+}
+
+//ring_sorted: A ascending from the top and B empty.
+//finish: prints OK/KO, or Error when the input or an instruction was bad.
+//"-" is refused here with Error: the operations are read from stdin, so the
+//numbers have to come from argv, --file or --bin.
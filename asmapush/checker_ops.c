@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   checker_ops.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/09 15:48:51 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/09 15:48:51 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	decode(const char *s, int len)
+{
+	if (len == 2 && s[0] == 's' && (s[1] == 'a' || s[1] == 'b' || s[1] == 's'))
+		return (OP_SA + (s[1] == 'b') + 2 * (s[1] == 's'));
+	if (len == 2 && s[0] == 'p' && (s[1] == 'a' || s[1] == 'b'))
+		return (OP_PA + (s[1] == 'b'));
+	if (len == 2 && s[0] == 'r' && (s[1] == 'a' || s[1] == 'b' || s[1] == 'r'))
+		return (OP_RA + (s[1] == 'b') + 2 * (s[1] == 'r'));
+	if (len == 3 && s[0] == 'r' && s[1] == 'r'
+		&& (s[2] == 'a' || s[2] == 'b' || s[2] == 'r'))
+		return (OP_RRA + (s[2] == 'b') + 2 * (s[2] == 'r'));
+	return (-1);
+}
+
+void	ring_apply(t_ring *a, t_ring *b, int op)
+{
+	if (op == OP_SA || op == OP_SS)
+		ring_swap(a);
+	if (op == OP_SB || op == OP_SS)
+		ring_swap(b);
+	if (op == OP_PA)
+		ring_push(a, b);
+	if (op == OP_PB)
+		ring_push(b, a);
+	if (op == OP_RA || op == OP_RR)
+		ring_rotate(a);
+	if (op == OP_RB || op == OP_RR)
+		ring_rotate(b);
+	if (op == OP_RRA || op == OP_RRR)
+		ring_rrotate(a);
+	if (op == OP_RRB || op == OP_RRR)
+		ring_rrotate(b);
+}
+
+static int	feed(t_ring *a, t_ring *b, char *line, char c)
+{
+	int	op;
+
+	if (c != '\n')
+	{
+		if (line[3] == 3)
+			return (0);
+		line[(int)line[3]++] = c;
+		return (1);
+	}
+	op = decode(line, line[3]);
+	if (op < 0)
+		return (0);
+	ring_apply(a, b, op);
+	line[3] = 0;
+	return (1);
+}
+
+int	read_ops(t_ring *a, t_ring *b)
+{
+	char	*buf;
+	char	line[4];
+	ssize_t	len;
+	ssize_t	i;
+
+	buf = malloc(CHECKER_BUF);
+	if (buf == NULL)
+		return (0);
+	line[3] = 0;
+	len = read(0, buf, CHECKER_BUF);
+	while (len > 0)
+	{
+		i = 0;
+		while (i < len && feed(a, b, line, buf[i]))
+			i++;
+		if (i < len)
+			break ;
+		len = read(0, buf, CHECKER_BUF);
+	}
+	free(buf);
+	return (len == 0 && line[3] == 0);
+}
+
+//decode: the instruction set is small enough that the first byte and the
+//length select the family and the last byte the stack, no table needed.
+//feed: line[0..2] collects one instruction, line[3] is its length.
+//read_ops: reads stdin in CHECKER_BUF chunks; returns 0 on a read error, an
+//unknown instruction or a last line without '\n'.
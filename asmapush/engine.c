@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   engine.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/20 10:14:45 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/21 10:05:16 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+int	engine_init(t_engine *engine, t_ps *src, t_kind kind, int arg)
+{
+	ft_bzero(engine, sizeof(t_engine));
+	engine->kind = kind;
+	engine->arg = arg;
+	engine->ps.breaks = src->breaks;
+	engine->ps.best = src->best;
+	engine->ps.nodes = nodes_copy(&engine->ps.a, &src->a);
+	return (engine->ps.nodes != NULL
+		&& stack_track(&engine->ps.a, src->a.cap)
+		&& stack_track(&engine->ps.b, src->a.cap));
+}
+
+static void	engine_lis(t_ps *ps)
+{
+	t_lis	lis;
+
+	if (lis_keep(&ps->a, &lis))
+		sort_lis(ps, &lis);
+	else
+		ps->stop = 1;
+	lis_free(&lis);
+}
+
+void	*engine_main(void *arg)
+{
+	t_engine	*engine;
+	size_t		best;
+
+	engine = (t_engine *)arg;
+	if (engine->kind == ENGINE_CHUNK)
+		sort_chunk(&engine->ps, engine->arg);
+	else if (engine->kind == ENGINE_RADIX)
+		sort_radix(&engine->ps);
+	else
+		engine_lis(&engine->ps);
+	best = __atomic_load_n(engine->ps.best, __ATOMIC_RELAXED);
+	while (!engine->ps.stop && engine->ps.out.len < best
+		&& !__atomic_compare_exchange_n(engine->ps.best, &best,
+			engine->ps.out.len, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+	return (NULL);
+}
+
+void	engine_free(t_engine *engine)
+{
+	free(engine->ps.out.buf);
+	free(engine->ps.a.key);
+	free(engine->ps.a.in);
+	free(engine->ps.b.key);
+	free(engine->ps.b.in);
+	free(engine->ps.nodes);
+}
+
+//An engine sorts its own copy of A. When it finishes without being stopped
+//it lowers *best to its length with a CAS loop, which stops every engine
+//whose output is already as long (see emit).
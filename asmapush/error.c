@@ -6,30 +6,29 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:23:59 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:24:01 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 11:48:09 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "push_swap.h"
 
-void	free_2d(char **x)
+void	ps_free(t_ps *ps)
 {
-	int	j;
-
-	j = 0;
-	while (x[j] != NULL)
-	{
-		free(x[j]);
-		j++;
-	}
-	free(x);
+	free(ps->out.buf);
+	free(ps->a.key);
+	free(ps->a.in);
+	free(ps->b.key);
+	free(ps->b.in);
+	free(ps->nodes);
+	ft_bzero(ps, sizeof(t_ps));
 }
 
-void	exit_any(t_list **stackA, char *s, char **x)
+void	free_exit(t_ps *ps, int error)
 {
-	free_2d(x);
-	ft_lstclear(stackA, free);
-	error_exit(s);
+	ps_free(ps);
+	if (error)
+		error_exit(NULL);
+	exit(0);
 }
 
 void	error_exit(char *arg_str)
@@ -38,3 +37,6 @@ void	error_exit(char *arg_str)
 	write(2, "Error\n", 6);
 	exit(1);
 }
+
+//ps_free: releases a run and leaves ps empty, so pars and sort can be
+//called again on it. Only the main functions exit.
@@ -6,75 +6,73 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:23:53 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:23:55 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/15 15:06:51 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "push_swap.h"
 
-int	find_length_min(t_list **stackB)
+int	find_length_min(t_stack *stackB)
 {
-	int		i;
-	t_list	*node;
+	return (stack_pos(stackB, stackB->min));
+}
 
-	node = *stackB;
-	i = 0;
-	while (node != NULL)
-	{
-		if (find_min(stackB) == node->content)
-			break ;
-		i++;
-		node = node->next;
-	}
-	return (i);
+int	find_length_index(t_stack *stackA, int index)
+{
+	return (stack_pos(stackA, index));
 }
 
-int	find_length_index(t_list **stackA, int index)
+static int	rank_of(int *sorted, int size, int content)
 {
-	int		i;
-	t_list	*node;
+	int	low;
+	int	high;
+	int	mid;
 
-	i = 0;
-	node = *stackA;
-	while (node != NULL)
+	low = 0;
+	high = size - 1;
+	while (low < high)
 	{
-		if (node->index == index)
-			break ;
-		i++;
-		node = node->next;
+		mid = low + (high - low) / 2;
+		if (sorted[mid] < content)
+			low = mid + 1;
+		else
+			high = mid;
 	}
-	return (i);
+	return (low);
 }
 
-void	fill_index(t_list **stackA)
+int	fill_index(t_stack *stackA)
 {
 	t_list	*node;
-	t_list	*temp_node;
+	int		*sorted;
 	int		i;
 
-	i = 1;
-	temp_node = *stackA;
-	node = *stackA;
-	while (temp_node != NULL)
+	sorted = malloc(sizeof(int) * stackA->size * 2);
+	if (sorted == NULL)
+		return (0);
+	i = 0;
+	node = stackA->top;
+	while (node != NULL)
 	{
-		node = *stackA;
-		while (node != NULL)
-		{
-			if (temp_node->content > node->content)
-				i++;
-			node = node->next;
-		}
-		temp_node->index = i;
-		i = 1;
-		temp_node = temp_node->next;
+		sorted[i++] = node->content;
+		node = node->next;
 	}
+	merge_sort(sorted, sorted + stackA->size, stackA->size);
+	node = stackA->top;
+	while (node != NULL)
+	{
+		node->index = rank_of(sorted, stackA->size, node->content) + 1;
+		node = node->next;
+	}
+	free(sorted);
+	return (1);
 }
 
-int	sorted(t_list **stackA)
+int	sorted(t_stack *stackA)
 {
 	t_list	*a;
 
-	a = *stackA;
+	a = stackA->top;
 	while (a->next)
 	{
 		if (a->content > a->next->content)
@@ -86,6 +84,8 @@ int	sorted(t_list **stackA)
 
 //Finds how far the minimum element is from the top of the stack.
 //Finds the number of steps needed to bring an element with a specific index to the top.
+//Both read the tracked keys (stack_pos), so they are O(1).
 //Assigns an index to each element in the stack based on its value, 
-//with the smallest getting index 1.
+//with the smallest getting index 1: a binary search in a sorted copy,
+//O(n log n) instead of comparing every pair.
 //Checks whether the stack is sorted in ascending order
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/21 15:22:08 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/26 10:12:45 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	grow(char **buf, size_t len, size_t *cap)
+{
+	char	*grown;
+
+	grown = malloc(*cap * 2 + 1);
+	if (grown != NULL)
+		ft_memcpy(grown, *buf, len);
+	free(*buf);
+	*buf = grown;
+	*cap *= 2;
+	return (grown != NULL);
+}
+
+char	*read_all(int fd, size_t *out)
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+	ssize_t	got;
+
+	len = 0;
+	cap = IN_BUF;
+	buf = malloc(cap + 1);
+	got = 1;
+	while (buf != NULL && got > 0)
+	{
+		if (len == cap && !grow(&buf, len, &cap))
+			return (NULL);
+		got = read(fd, buf + len, cap - len);
+		if (got > 0)
+			len += got;
+	}
+	if (buf == NULL || got < 0)
+	{
+		free(buf);
+		return (NULL);
+	}
+	buf[len] = '\0';
+	*out = len;
+	return (buf);
+}
+
+static int	*read_text(int fd, int *count)
+{
+	char	*text[3];
+	int		*values;
+	size_t	len;
+
+	*count = 0;
+	if (fd < 0)
+		return (NULL);
+	text[0] = NULL;
+	text[1] = read_all(fd, &len);
+	text[2] = NULL;
+	if (fd != 0)
+		close(fd);
+	if (text[1] == NULL)
+		return (NULL);
+	values = parse_args(text, count);
+	free(text[1]);
+	return (values);
+}
+
+int	read_flags(t_ps *ps, char **av)
+{
+	int	flags;
+
+	flags = 0;
+	while (av[flags + 1] != NULL)
+	{
+		if (ft_strncmp(av[flags + 1], LIS_FLAG, sizeof(LIS_FLAG)) == 0)
+			ps->lis = 1;
+		else if (ft_strncmp(av[flags + 1], PACK_FLAG, sizeof(PACK_FLAG)) == 0)
+			ps->pack = 1;
+		else
+			break ;
+		flags++;
+	}
+	return (flags);
+}
+
+int	*input_values(char **av, int *count)
+{
+	if (av[1] != NULL && av[2] == NULL && ft_strncmp(av[1], "-", 2) == 0)
+		return (read_text(0, count));
+	if (av[1] != NULL && av[2] != NULL && av[3] == NULL
+		&& ft_strncmp(av[1], "--file", 7) == 0)
+		return (read_text(open(av[2], O_RDONLY), count));
+	if (av[1] != NULL && av[2] != NULL && av[3] == NULL
+		&& ft_strncmp(av[1], "--bin", 6) == 0)
+		return (read_bin(av[2], count));
+	return (parse_args(av, count));
+}
+
+//read_flags: the leading LIS_FLAG / PACK_FLAG options, how many there are.
+//Where the numbers come from, argv being the default:
+//  -              whitespace separated text on stdin
+//  --file <path>  the same text from a file
+//  --bin <path>   raw little-endian int32 values, mapped with mmap
+//Text is read IN_BUF bytes at a time into one buffer and goes through
+//parse_args like argv, so signs, overflow and duplicates follow the same
+//rules. A binary file must hold a whole, non zero number of values.
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_bin.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/21 16:04:51 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/21 16:04:51 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	*decode_bin(unsigned char *bytes, int count)
+{
+	int	*values;
+	int	i;
+
+	values = malloc(sizeof(int) * count);
+	i = -1;
+	while (values != NULL && ++i < count)
+		values[i] = (int)((uint32_t)bytes[4 * i]
+				| (uint32_t)bytes[4 * i + 1] << 8
+				| (uint32_t)bytes[4 * i + 2] << 16
+				| (uint32_t)bytes[4 * i + 3] << 24);
+	return (values);
+}
+
+int	*read_bin(char *path, int *count)
+{
+	struct stat	st;
+	void		*map;
+	int			*values;
+	int			fd;
+
+	*count = 0;
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0 || st.st_size == 0 || st.st_size % 4
+		|| st.st_size / 4 > INT_MAX)
+	{
+		if (fd >= 0)
+			close(fd);
+		return (NULL);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+	*count = st.st_size / 4;
+	values = decode_bin(map, *count);
+	munmap(map, st.st_size);
+	return (values);
+}
+
+//--bin input: the file is mapped read-only and every 4 bytes are read as
+//one little-endian int32, whatever the byte order of the machine.
@@ -6,7 +6,7 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:25:07 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:25:08 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 15:44:10 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,16 +25,7 @@ void	free_3d(char **x)
 	free(x);
 }
 
-void	error_exit1(t_list **stack_a, char *s, char **x)
-{
-	ft_lstclear(stack_a, free);
-	free_3d(x);
-	free(s);
-	write(2, "Error\n", 6);
-	exit(1);
-}
-
-int	ft_atoi(const char *str, t_list **stack_a, char *s, char **x)
+int	ft_atoi(const char *str)
 {
 	int				i;
 	int				k;
@@ -54,10 +45,6 @@ int	ft_atoi(const char *str, t_list **stack_a, char *s, char **x)
 	while (str[i] >= '0' && str[i] <= '9')
 	{
 		value = (value * 10) + (str[i] - 48);
-		if (value > 2147483647 && k == 1)
-			error_exit1(stack_a, s, x);
-		if (value > 2147483648 && k == -1)
-			error_exit1(stack_a, s, x);
 		i++;
 	}
 	return (value * k);
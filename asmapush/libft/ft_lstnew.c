@@ -20,6 +20,7 @@ t_list	*ft_lstnew(int content)
 	if (!new)
 		return (NULL);
 	new->next = NULL;
+	new->prev = NULL;
 	new->content = content;
 	new->index = 0;
 	return (new);
@@ -6,7 +6,7 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:31:50 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:31:51 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 15:44:10 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,6 +27,7 @@ typedef struct s_list
 	int				index;
 
 	struct s_list	*next;
+	struct s_list	*prev;
 }					t_list;
 
 void				ft_bzero(void *str, size_t n);
@@ -52,9 +53,7 @@ void				*ft_memchr(const void *s, int c, size_t n);
 int					ft_strncmp(const char *s1, const char *s2, size_t n);
 char				*ft_strnstr(const char *haystack, const char *needle,
 						size_t len);
-int					ft_atoi(const char *str, t_list **stack_a, char *s,
-						char **x);
-void				error_exit1(t_list **stack_a, char *s, char **x);
+int					ft_atoi(const char *str);
 void				free_3d(char **x);
 char				*ft_substr(char const *s, unsigned int start, size_t len);
 char				*ft_strjoin(char const *s1, char const *s2);
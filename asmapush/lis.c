@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lis.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/19 14:12:36 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/19 14:12:36 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	*lis_sequence(t_stack *stackA)
+{
+	int		*seq;
+	int		start;
+	t_list	*node;
+	int		i;
+
+	seq = malloc(sizeof(int) * stackA->size * 3);
+	if (seq == NULL)
+		return (NULL);
+	start = stack_pos(stackA, stackA->min);
+	i = 0;
+	node = stackA->top;
+	while (node != NULL)
+	{
+		seq[(i - start + stackA->size) % stackA->size] = node->index;
+		node = node->next;
+		i++;
+	}
+	return (seq);
+}
+
+static int	lis_place(int *seq, int *tails, int len, int value)
+{
+	int	low;
+	int	high;
+	int	mid;
+
+	low = 0;
+	high = len;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if (seq[tails[mid]] < value)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return (low);
+}
+
+static void	lis_mark(int *seq, int n, t_lis *lis)
+{
+	int	*tails;
+	int	*prev;
+	int	i;
+	int	k;
+
+	tails = seq + n;
+	prev = seq + 2 * n;
+	i = -1;
+	while (++i < n)
+	{
+		k = lis_place(seq, tails, lis->len, seq[i]);
+		prev[i] = -1;
+		if (k > 0)
+			prev[i] = tails[k - 1];
+		tails[k] = i;
+		if (k == lis->len)
+			lis->len++;
+	}
+	i = tails[lis->len - 1];
+	while (i >= 0)
+	{
+		lis->keep[seq[i]] = 1;
+		i = prev[i];
+	}
+}
+
+int	lis_keep(t_stack *stackA, t_lis *lis)
+{
+	int	*seq;
+
+	lis->n = stackA->size;
+	lis->len = 0;
+	lis->keep = ft_calloc(lis->n + 1, sizeof(char));
+	lis->tree = ft_calloc(lis->n + 1, sizeof(int));
+	seq = lis_sequence(stackA);
+	if (lis->keep == NULL || lis->tree == NULL || seq == NULL)
+	{
+		free(seq);
+		return (0);
+	}
+	lis_mark(seq, lis->n, lis);
+	free(seq);
+	lis->top = 1;
+	while (lis->top * 2 <= lis->n)
+		lis->top *= 2;
+	return (1);
+}
+
+//Longest increasing subsequence of the ranks of A, read cyclically from the
+//minimum: patience sorting with a binary search over the tails, O(n log n).
+//Starting at rank 1 makes the minimum part of it, so the kept ranks already
+//form a rotation of the sorted order once everything else is in B.
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lis_move.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/19 15:03:58 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/19 15:03:58 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	move_abs(int value)
+{
+	if (value < 0)
+		return (-value);
+	return (value);
+}
+
+static void	move_try(t_move *best, int a, int b, int rank)
+{
+	int	cost;
+
+	if ((a >= 0) == (b >= 0) && move_abs(a) > move_abs(b))
+		cost = move_abs(a);
+	else if ((a >= 0) == (b >= 0))
+		cost = move_abs(b);
+	else
+		cost = move_abs(a) + move_abs(b);
+	if (cost < best->cost)
+	{
+		best->a = a;
+		best->b = b;
+		best->cost = cost;
+		best->rank = rank;
+	}
+}
+
+void	move_best(t_ps *ps, t_lis *lis, t_list *node, int pos)
+{
+	int		target;
+	int		at;
+	int		back_a;
+	int		back_b;
+
+	target = lis_next(lis, node->index);
+	if (target == 0)
+		target = ps->a.min;
+	at = stack_pos(&ps->a, target);
+	back_a = 0;
+	if (at > 0)
+		back_a = at - ps->a.size;
+	back_b = 0;
+	if (pos > 0)
+		back_b = pos - ps->b.size;
+	move_try(&lis->best, at, pos, node->index);
+	move_try(&lis->best, back_a, back_b, node->index);
+	move_try(&lis->best, at, back_b, node->index);
+	move_try(&lis->best, back_a, pos, node->index);
+}
+
+void	move_apply(t_ps *ps, t_move *move)
+{
+	while (move->a > 0 && move->b > 0 && move->a-- && move->b--)
+		rr(ps);
+	while (move->a < 0 && move->b < 0 && move->a++ && move->b++)
+		rrr(ps);
+	while (move->a > 0 && move->a--)
+		ra(ps);
+	while (move->a < 0 && move->a++)
+		rra(ps);
+	while (move->b > 0 && move->b--)
+		rb(ps);
+	while (move->b < 0 && move->b++)
+		rrb(ps);
+	pa(ps);
+}
+
+//A move costs the larger of the two rotations when both go the same way,
+//since rr and rrr turn A and B together, and their sum otherwise.
+//The target is the smallest rank of A above the node (from the Fenwick
+//tree, O(log n)), or the minimum when the node is larger than all of A.
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lis_sort.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/19 16:27:10 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/20 11:08:40 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static void	push_unkept(t_ps *ps, t_lis *lis)
+{
+	int	count;
+
+	count = lis->n - lis->len;
+	while (count > 0 && !ps->stop)
+	{
+		if (lis->keep[ps->a.top->index])
+			ra(ps);
+		else
+		{
+			pb(ps);
+			count--;
+			if (ps->b.size > 1 && ps->b.top->index <= lis->n / 2)
+			{
+				if (count > 0 && lis->keep[ps->a.top->index])
+					rr(ps);
+				else
+					rb(ps);
+			}
+		}
+	}
+}
+
+static void	pick_move(t_ps *ps, t_lis *lis)
+{
+	t_list	*top;
+	t_list	*bottom;
+	int		d;
+
+	lis->best.cost = 2147483647;
+	top = ps->b.top;
+	bottom = ps->b.bottom;
+	d = 0;
+	while (d < lis->best.cost && d <= ps->b.size - 1 - d)
+	{
+		move_best(ps, lis, top, d);
+		if (d != ps->b.size - 1 - d)
+			move_best(ps, lis, bottom, ps->b.size - 1 - d);
+		top = top->next;
+		bottom = bottom->prev;
+		d++;
+	}
+}
+
+void	sort_lis(t_ps *ps, t_lis *lis)
+{
+	int	rank;
+
+	push_unkept(ps, lis);
+	rank = 0;
+	while (++rank <= lis->n)
+		if (lis->keep[rank])
+			lis_add(lis, rank);
+	while (ps->b.size > 0 && !ps->stop)
+	{
+		pick_move(ps, lis);
+		move_apply(ps, &lis->best);
+		lis_add(lis, lis->best.rank);
+	}
+	sort_rotate(ps);
+}
+
+//LIS mode: the ranks of the longest increasing subsequence stay in A, the
+//others go to B (the lower half to the bottom of B), then come back one at
+//a time, each time the one whose move is cheapest.
+//pick_move walks B from both ends at once and stops when the distance from
+//the ends alone costs more than the best move found so far.
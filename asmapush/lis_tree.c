@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lis_tree.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/19 15:03:58 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/19 15:03:58 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+void	lis_add(t_lis *lis, int rank)
+{
+	while (rank <= lis->n)
+	{
+		lis->tree[rank]++;
+		rank += rank & -rank;
+	}
+}
+
+int	lis_next(t_lis *lis, int rank)
+{
+	int	count;
+	int	pos;
+	int	step;
+
+	count = 1;
+	pos = rank;
+	while (pos > 0)
+	{
+		count += lis->tree[pos];
+		pos -= pos & -pos;
+	}
+	pos = 0;
+	step = lis->top;
+	while (step > 0)
+	{
+		if (pos + step <= lis->n && lis->tree[pos + step] < count)
+		{
+			pos += step;
+			count -= lis->tree[pos];
+		}
+		step /= 2;
+	}
+	if (pos + 1 > lis->n)
+		return (0);
+	return (pos + 1);
+}
+
+void	lis_free(t_lis *lis)
+{
+	free(lis->keep);
+	free(lis->tree);
+	lis->keep = NULL;
+	lis->tree = NULL;
+}
+
+//Fenwick tree over the ranks held by A while B is inserted back.
+//lis_next counts the held ranks up to rank, then walks down the tree for
+//the next one: the smallest held rank above it, 0 if there is none.
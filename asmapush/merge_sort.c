@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   merge_sort.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/07 11:40:12 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/07 11:40:12 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static void	merge(int *arr, int *tmp, int mid, int n)
+{
+	int	i;
+	int	j;
+	int	k;
+
+	i = 0;
+	j = mid;
+	k = 0;
+	while (i < mid && j < n)
+	{
+		if (arr[i] <= arr[j])
+			tmp[k++] = arr[i++];
+		else
+			tmp[k++] = arr[j++];
+	}
+	while (i < mid)
+		tmp[k++] = arr[i++];
+	while (j < n)
+		tmp[k++] = arr[j++];
+	ft_memcpy(arr, tmp, sizeof(int) * n);
+}
+
+void	merge_sort(int *arr, int *tmp, int n)
+{
+	if (n < 2)
+		return ;
+	merge_sort(arr, tmp, n / 2);
+	merge_sort(arr + n / 2, tmp, n - n / 2);
+	merge(arr, tmp, n / 2, n);
+}
+
+int	has_duplicates(int *values, int count)
+{
+	int	*sorted;
+	int	i;
+
+	sorted = malloc(sizeof(int) * count * 2);
+	if (sorted == NULL)
+		return (1);
+	ft_memcpy(sorted, values, sizeof(int) * count);
+	merge_sort(sorted, sorted + count, count);
+	i = 0;
+	while (++i < count)
+		if (sorted[i] == sorted[i - 1])
+			break ;
+	free(sorted);
+	return (i < count);
+}
+
+//merge_sort: top-down merge sort of n ints, tmp must hold n ints.
+//has_duplicates: sorts a copy so equal numbers end up side by side.
@@ -6,18 +6,18 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:23:33 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:23:35 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/20 11:08:40 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "push_swap.h"
 
-int	find_min(t_list **stackA)
+int	find_min(t_stack *stackA)
 {
 	int		min;
 	t_list	*node;
 
-	node = *stackA;
+	node = stackA->top;
 	min = 2147483647;
 	while (node != NULL)
 	{
@@ -28,28 +28,17 @@ int	find_min(t_list **stackA)
 	return (min);
 }
 
-int	find_min_index(t_list **stackA)
+int	find_min_index(t_stack *stackA)
 {
-	int		min;
-	t_list	*node;
-
-	node = *stackA;
-	min = 2147483647;
-	while (node != NULL)
-	{
-		if (min > node->index)
-			min = node->index;
-		node = node->next;
-	}
-	return (min);
+	return (stackA->min);
 }
 
-int	find_max(t_list **stackA)
+int	find_max(t_stack *stackA)
 {
 	int		max;
 	t_list	*node;
 
-	node = *stackA;
+	node = stackA->top;
 	max = -2147483648;
 	while (node != NULL)
 	{
@@ -60,45 +49,36 @@ int	find_max(t_list **stackA)
 	return (max);
 }
 
-int	find_max_index(t_list **stackA)
+int	find_max_index(t_stack *stackA)
 {
-	int		max;
-	t_list	*node;
-
-	node = *stackA;
-	max = -2147483648;
-	while (node != NULL)
-	{
-		if (max < node->index)
-			max = node->index;
-		node = node->next;
-	}
-	return (max);
+	return (stackA->max);
 }
 
-void	pback(t_list **stackA, t_list **stackB)
+void	pback(t_ps *ps)
 {
 	t_list	*b;
 	int		max;
 
-	b = *(stackB);
-	while (ft_lstsize(*stackB) > 0)
+	b = ps->b.top;
+	while (ps->b.size > 0 && !ps->stop)
 	{
-		max = find_max_index(stackB);
+		max = find_max_index(&ps->b);
 		if ((b)->index == max)
-			pa(stackB, stackA);
+			pa(ps);
 		else
 		{
-			if (find_length_index(stackB, max) >= (ft_lstsize(*stackB) / 2))
-				rrb(stackB);
+			if (find_length_index(&ps->b, max) >= (ps->b.size / 2))
+				rrb(ps);
 			else
-				rb(stackB);
+				rb(ps);
 		}
-		b = *(stackB);
+		b = ps->b.top;
 	}
 }
 
 //find the int min and start sorting from this
+//find_min_index / find_max_index read the ranks tracked by the stack, so
+//every pback step is O(1) instead of a scan of B.
 
 //After finding the minimum and maximum values and indexes, the algorithm uses these values to 
 //perform operations like pa, pb,
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   nodes.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/21 09:37:52 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/21 09:37:52 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+t_list	*nodes_fill(t_stack *stack, int *values, int count)
+{
+	t_list	*nodes;
+
+	nodes = malloc(sizeof(t_list) * count);
+	if (nodes == NULL)
+		return (NULL);
+	while (count-- > 0)
+	{
+		nodes[count].content = values[count];
+		nodes[count].index = 0;
+		stack_add_top(stack, &nodes[count]);
+	}
+	return (nodes);
+}
+
+t_list	*nodes_copy(t_stack *dst, t_stack *src)
+{
+	t_list	*nodes;
+	t_list	*node;
+	int		i;
+
+	nodes = malloc(sizeof(t_list) * src->size);
+	if (nodes == NULL)
+		return (NULL);
+	i = src->size;
+	node = src->bottom;
+	while (node != NULL)
+	{
+		nodes[--i].content = node->content;
+		nodes[i].index = node->index;
+		stack_add_top(dst, &nodes[i]);
+		node = node->prev;
+	}
+	return (nodes);
+}
+
+//All the nodes of a run live in one block, handed out top to bottom, so a
+//walk down A reads memory in order and one free releases every node,
+//wherever it ended up (A or B).
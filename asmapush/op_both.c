@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   op_both.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/02 10:20:16 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/24 10:30:05 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+void	ss(t_ps *ps)
+{
+	apply_op(ps, OP_SS);
+}
+
+void	rr(t_ps *ps)
+{
+	apply_op(ps, OP_RR);
+}
+
+void	rrr(t_ps *ps)
+{
+	apply_op(ps, OP_RRR);
+}
+//ss, rr, rrr: sa/sb, ra/rb and rra/rrb applied to both stacks as one move.
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ops.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/24 10:12:33 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/27 17:20:31 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static const char	g_kind[11] = {0, 0, 0, 3, 3, 1, 1, 1, 2, 2, 2};
+static const char	g_on[11] = {1, 2, 3, 1, 2, 1, 2, 3, 1, 2, 3};
+static const char	g_inverse[11] = {OP_SA, OP_SB, OP_SS, OP_PB, OP_PA,
+	OP_RRA, OP_RRB, OP_RRR, OP_RA, OP_RB, OP_RR};
+
+static void	move(t_stack *stack, int kind)
+{
+	if (kind == 0)
+		stack_swap(stack);
+	else if (kind == 1)
+		stack_rotate(stack);
+	else
+		stack_rrotate(stack);
+}
+
+int	op_apply(t_ps *ps, int op)
+{
+	if (g_kind[op] == 3 && g_on[op] == 1 && ps->b.size > 0)
+		stack_add_top(&ps->a, stack_pop(&ps->b));
+	else if (g_kind[op] == 3 && g_on[op] == 2 && ps->a.size > 0)
+		stack_add_top(&ps->b, stack_pop(&ps->a));
+	else if (g_kind[op] != 3 && (!(g_on[op] & 1) || ps->a.size > 1)
+		&& (!(g_on[op] & 2) || ps->b.size > 1))
+	{
+		if (g_on[op] & 1)
+			move(&ps->a, g_kind[op]);
+		if (g_on[op] & 2)
+			move(&ps->b, g_kind[op]);
+	}
+	else
+		return (0);
+	return (1);
+}
+
+int	op_inverse(int op)
+{
+	return (g_inverse[op]);
+}
+
+void	apply_op(t_ps *ps, int op)
+{
+	if (op_apply(ps, op))
+		emit(ps, op);
+}
+
+//One kernel for all eleven operations. g_kind: 0 swap, 1 rotate,
+//2 reverse rotate, 3 push; g_on: 1 for A, 2 for B, 3 for both (for a push,
+//the stack that receives). The moves come from stack.c, so key, in,
+//min and max stay tracked.
+//op_apply: moves the stacks only, no output; returns 0 and leaves them
+//alone when the operation would be a no-op (too few nodes).
+//op_inverse: the operation that takes op back; the beam search uses it to
+//skip children that undo their parent.
+//apply_op: op_apply plus emit, what sa ... rrr do.
+//beam_apply (rank bytes), ring_apply (checker ring) and tools/gen_small.c
+//keep their own moves: they work on flat arrays where a t_ps would cost a
+//list walk per op. tools/fuzz_ps.c runs all three against op_apply.
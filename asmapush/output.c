@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/13 10:41:09 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/20 11:08:40 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static const char	*g_names[11] = {"sa\n", "sb\n", "ss\n", "pa\n", "pb\n",
+	"ra\n", "rb\n", "rr\n", "rra\n", "rrb\n", "rrr\n"};
+
+static int	ops_grow(t_ops *out)
+{
+	unsigned char	*buf;
+	size_t			cap;
+
+	cap = out->cap * 2;
+	if (cap == 0)
+		cap = OUT_BUF;
+	buf = malloc(cap);
+	if (buf == NULL)
+		return (0);
+	if (out->len > 0)
+		ft_memcpy(buf, out->buf, out->len);
+	free(out->buf);
+	out->buf = buf;
+	out->cap = cap;
+	return (1);
+}
+
+void	emit(t_ps *ps, int op)
+{
+	if (ps->best != NULL && (ps->out.len >= __atomic_load_n(ps->best,
+				__ATOMIC_RELAXED) || (ps->out.len == ps->out.cap
+				&& !ops_grow(&ps->out))))
+	{
+		ps->stop = 1;
+		return ;
+	}
+	if (ps->out.len == ps->out.cap && !ops_grow(&ps->out))
+	{
+		flush_ops(ps);
+		if (ps->out.buf == NULL)
+		{
+			ft_putstr_fd((char *)g_names[op], 1);
+			return ;
+		}
+	}
+	ps->out.buf[ps->out.len++] = op;
+}
+
+void	flush_ops(t_ps *ps)
+{
+	char		text[OUT_BUF];
+	size_t		len;
+	size_t		i;
+	const char	*name;
+
+	len = 0;
+	i = 0;
+	while (i < ps->out.len)
+	{
+		name = g_names[ps->out.buf[i++]];
+		while (*name)
+			text[len++] = *name++;
+		if (len > OUT_BUF - 4 || i == ps->out.len)
+		{
+			write(1, text, len);
+			len = 0;
+		}
+	}
+	ps->out.len = 0;
+}
+
+//emit: records one operation; when the buffer can not grow it is flushed
+//and reused, and without any buffer the name is written directly.
+//A portfolio engine (best set) never prints: it stops instead, once its
+//output is as long as the best finished one or can not grow.
+//flush_ops: turns the recorded operations into text OUT_BUF bytes at a time.
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pack.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/25 13:40:11 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/25 13:40:11 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+int	pack_byte(t_pack *pk, int byte)
+{
+	unsigned char	*buf;
+
+	if (pk->len == pk->cap)
+	{
+		pk->cap = pk->cap * 2 + OUT_BUF * (pk->cap == 0);
+		buf = malloc(pk->cap);
+		if (buf == NULL)
+			return (0);
+		if (pk->len > 0)
+			ft_memcpy(buf, pk->buf, pk->len);
+		free(pk->buf);
+		pk->buf = buf;
+	}
+	pk->buf[pk->len++] = byte;
+	pk->half = 0;
+	return (1);
+}
+
+int	pack_uint(t_pack *pk, uint32_t value, int bytes)
+{
+	while (bytes-- > 0)
+	{
+		if (!pack_byte(pk, value & 0xff))
+			return (0);
+		value >>= 8;
+	}
+	return (1);
+}
+
+int	pack_nib(t_pack *pk, int nib)
+{
+	if (pk->half)
+	{
+		pk->buf[pk->len - 1] |= nib;
+		pk->half = 0;
+		return (1);
+	}
+	if (!pack_byte(pk, nib << 4))
+		return (0);
+	pk->half = 1;
+	return (1);
+}
+
+void	pack_seen(t_pack *pk, int op)
+{
+	if (op == pk->last)
+		return ;
+	pk->prev = pk->last;
+	pk->last = op;
+}
+
+int	pack_head(t_pack *pk, t_ps *ps, int count)
+{
+	size_t	i;
+	int		width;
+	int		ok;
+
+	ft_bzero(pk, sizeof(t_pack));
+	pk->last = -1;
+	pk->prev = -1;
+	width = 2 + 2 * (count > 65536);
+	ok = pack_uint(pk, PACK_MAGIC, 4) && pack_uint(pk, count, 4)
+		&& pack_byte(pk, width);
+	i = 0;
+	while (ok && i < (size_t)count)
+		ok = pack_uint(pk, ps->nodes[i++].index - 1, width);
+	return (ok && pack_uint(pk, ps->out.len, 4));
+}
+
+//Byte and nibble writer for the packed format (see pack_ops.c).
+//pack_head: everything before the operations. The nodes block still holds
+//the input in order, whatever sort did, so the ranks come from it.
+//pack_seen: the state shared by the encoder and the decoder, the last op
+//and the last op before it that was different (-1 while unknown).
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pack_ops.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/25 14:26:48 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/25 14:26:48 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static size_t	run_of(t_ops *ops, size_t i, int op, size_t max)
+{
+	size_t	run;
+
+	run = 0;
+	while (i + run < ops->len && run < max && ops->buf[i + run] == op)
+		run++;
+	return (run);
+}
+
+static int	mix_of(t_pack *pk, t_ops *ops, size_t i)
+{
+	int	mask;
+	int	k;
+
+	if (pk->prev < 0 || i + 4 > ops->len)
+		return (-1);
+	mask = 0;
+	k = -1;
+	while (++k < 4)
+	{
+		if (ops->buf[i + k] != pk->last && ops->buf[i + k] != pk->prev)
+			return (-1);
+		mask = mask << 1 | (ops->buf[i + k] == pk->last);
+	}
+	return (mask);
+}
+
+static int	pack_run(t_pack *pk, size_t run)
+{
+	if (run <= 16)
+		return (pack_nib(pk, PACK_REP) && pack_nib(pk, run - 1));
+	return (pack_nib(pk, PACK_LONG) && pack_nib(pk, (run - 1) >> 12)
+		&& pack_nib(pk, (run - 1) >> 8 & 15)
+		&& pack_nib(pk, (run - 1) >> 4 & 15) && pack_nib(pk, (run - 1) & 15));
+}
+
+static size_t	pack_step(t_pack *pk, t_ops *ops, size_t i)
+{
+	size_t	run;
+	int		mask;
+	int		k;
+
+	run = run_of(ops, i, pk->last, 65536);
+	mask = mix_of(pk, ops, i);
+	if (run >= 4 || (run == 3 && mask < 0))
+		return (run * pack_run(pk, run));
+	if (mask >= 0 && pack_nib(pk, PACK_MIX) && pack_nib(pk, mask))
+	{
+		k = -1;
+		while (++k < 4)
+			pack_seen(pk, ops->buf[i + k]);
+		return (4);
+	}
+	if (mask >= 0 || !pack_nib(pk, ops->buf[i]))
+		return (0);
+	pack_seen(pk, ops->buf[i]);
+	return (1);
+}
+
+int	pack_ops(t_ps *ps, int count)
+{
+	t_pack	pk;
+	size_t	i;
+	size_t	step;
+	int		ok;
+
+	ok = pack_head(&pk, ps, count);
+	i = 0;
+	step = 1;
+	while (ok && i < ps->out.len && step > 0)
+	{
+		step = pack_step(&pk, &ps->out, i);
+		i += step;
+	}
+	if (ok && step > 0)
+		write(1, pk.buf, pk.len);
+	free(pk.buf);
+	ps->out.len = 0;
+	return (ok && step > 0);
+}
+
+//--pack output: an archive instead of text, all numbers little-endian.
+//  u32 PACK_MAGIC, u32 n, u8 width (2, or 4 past 65536 values),
+//  n ranks 0 .. n - 1 of the input (top first, width bytes each),
+//  u32 op count, then the operations as 4-bit codes, high nibble first:
+//  0-10        one t_op
+//  PACK_REP r  the last op r + 1 more times (r: one nibble)
+//  PACK_LONG   the same with a 16-bit r in four nibbles
+//  PACK_MIX m  four ops, one per bit of m from the top: 1 for the last op,
+//              0 for the different op before it (radix-like pb/ra runs)
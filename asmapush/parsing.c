@@ -6,95 +6,109 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:23:03 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:23:10 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 11:48:09 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "push_swap.h"
 
-char	*join_everthing(char **av)
+static int	is_space(char c)
 {
+	return (c == ' ' || (c >= 9 && c <= 13));
+}
+
+static int	count_tokens(char **av)
+{
+	int		count;
 	char	*s;
-	int		i;
 
-	s = NULL;
-	i = 1;
-	while (av[i])
+	count = 0;
+	while (*++av)
 	{
-		s = ft_strjoin_mod(s, av[i]);
-		s = ft_strjoin_mod(s, " ");
-		i++;
+		s = *av;
+		while (*s)
+		{
+			if (!is_space(*s) && (s == *av || is_space(s[-1])))
+				count++;
+			s++;
+		}
 	}
-	i = 0;
-	while (s[i] != '\0')
-	{
-		if (ft_isdigit(s[i]) == 0)
-			error_exit(s);
-		i++;
-	}
-	return (s);
+	return (count);
 }
 
-void	check_double_sign(char *arg_str)
+static char	*parse_number(char *s, int *out)
 {
-	int	i;
+	long	value;
+	int		sign;
 
-	i = -1;
-	while (arg_str[++i] != '\0')
-		if (arg_str[i] == '+' || arg_str[i] == '-')
-			if (arg_str[i + 1] == '+' || arg_str[i + 1] == '-')
-				error_exit(arg_str);
+	sign = 1;
+	if (*s == '+' || *s == '-')
+		if (*s++ == '-')
+			sign = -1;
+	if (*s < '0' || *s > '9')
+		return (NULL);
+	value = 0;
+	while (*s >= '0' && *s <= '9')
+	{
+		value = value * 10 + (*s++ - '0');
+		if (value - (sign == -1) > INT_MAX)
+			return (NULL);
+	}
+	if (*s != '\0' && !is_space(*s))
+		return (NULL);
+	*out = value * sign;
+	return (s);
 }
 
-void	pars_help(t_list **stackA, char *arg_str, char **x)
+int	*parse_args(char **av, int *count)
 {
-	int		i;
-	int		c;
-	t_list	*elem;
+	int		*values;
+	char	*s;
+	int		n;
 
-	i = 0;
-	while (x[i])
+	*count = count_tokens(av);
+	values = NULL;
+	if (*count > 0)
+		values = malloc(sizeof(int) * *count);
+	n = 0;
+	s = "";
+	while (values != NULL && s != NULL && (*s || *++av))
 	{
-		c = -1;
-		if ((x[i][0] == '-' || x[i][0] == '+') && x[i][1] == '\0')
-			exit_any(stackA, arg_str, x);
-		while (x[i][++c] != '\0')
-			if ((x[i][c] == '-' || x[i][c] == '+') && c != 0)
-				exit_any(stackA, arg_str, x);
-		elem = ft_lstnew(ft_atoi((x[i]), stackA, arg_str, x));
-		if (elem == NULL)
-			exit_any(stackA, arg_str, x);
-		ft_lstadd_back(stackA, elem);
-		i++;
+		if (*s == '\0')
+			s = *av;
+		else if (is_space(*s))
+			s++;
+		else
+			s = parse_number(s, &values[n++]);
 	}
+	if (s != NULL)
+		return (values);
+	free(values);
+	return (NULL);
 }
 
-int	pars(t_list **stackA, char **av)
+int	pars(t_ps *ps, char **av)
 {
-	char	*arg_str;
-	char	**x;
+	int		*values;
+	int		count;
 
-	arg_str = join_everthing(av);
-	check_double_sign(arg_str);
-	x = ft_split(arg_str, ' ');
-	if (*x == NULL)
+	values = input_values(av, &count);
+	if (values == NULL || has_duplicates(values, count))
 	{
-		free(x);
-		error_exit(arg_str);
+		free(values);
+		return (0);
 	}
-	pars_help(stackA, arg_str, x);
-	free_2d(x);
-	free(arg_str);
-	cheak_doubls(stackA);
-	return (1);
+	ps->nodes = nodes_fill(&ps->a, values, count);
+	free(values);
+	return (ps->nodes != NULL);
 }
 
-
 // summary of Error-Handling Steps
-// Double signs (++, --) → Checked in check_double_sign.
-// Non-numeric characters → Checked in join_everthing.
-// Standalone signs → Checked in pars_help.
-// Duplicates → Checked in cheak_doubls.
-// Integer overflow → Checked in ft_atoi.
-// Empty or invalid input → Checked throughout parsing steps.
-// Memory cleanup → Ensures no memory leaks on error.
+// Every token is read straight from argv, nothing is joined or split.
+// Signs → at most one, and only in front of at least one digit.
+// Non-numeric characters → anything but digits or spaces inside a token.
+// Integer overflow → checked digit by digit in parse_number.
+// Duplicates → Checked in has_duplicates on a sorted copy.
+// Empty input → no tokens at all is an error.
+// Memory cleanup → the array is freed and pars returns 0, the caller prints
+// Error; nothing here exits.
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   portfolio.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/20 10:51:33 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/20 10:51:33 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	portfolio_init(t_engine *engines, t_ps *ps)
+{
+	int	chnk;
+	int	ok;
+
+	chnk = ft_chunks(&ps->a, ps->breaks);
+	ok = engine_init(&engines[0], ps, ENGINE_CHUNK, chnk);
+	ok &= engine_init(&engines[1], ps, ENGINE_CHUNK, chnk * 2 / 3 + 1);
+	ok &= engine_init(&engines[2], ps, ENGINE_CHUNK, chnk * 3 / 2);
+	ok &= engine_init(&engines[3], ps, ENGINE_CHUNK, chnk * 2);
+	ok &= engine_init(&engines[4], ps, ENGINE_RADIX, 0);
+	ok &= engine_init(&engines[5], ps, ENGINE_LIS, 0);
+	return (ok);
+}
+
+static void	portfolio_run(t_engine *engines)
+{
+	int	i;
+
+	i = -1;
+	while (++i < ENGINES)
+	{
+		engines[i].started = !pthread_create(&engines[i].thread, NULL,
+				engine_main, &engines[i]);
+		if (!engines[i].started)
+			engine_main(&engines[i]);
+	}
+	i = -1;
+	while (++i < ENGINES)
+		if (engines[i].started)
+			pthread_join(engines[i].thread, NULL);
+}
+
+static t_engine	*portfolio_pick(t_engine *engines)
+{
+	t_engine	*win;
+	int			i;
+
+	win = NULL;
+	i = -1;
+	while (++i < ENGINES)
+		if (!engines[i].ps.stop
+			&& (win == NULL || engines[i].ps.out.len < win->ps.out.len))
+			win = &engines[i];
+	return (win);
+}
+
+int	sort_portfolio(t_ps *ps)
+{
+	t_engine	engines[ENGINES];
+	t_engine	*win;
+	size_t		best;
+	size_t		i;
+	int			ok;
+
+	best = (size_t)-1;
+	ps->best = &best;
+	ok = portfolio_init(engines, ps);
+	ps->best = NULL;
+	win = NULL;
+	if (ok)
+		portfolio_run(engines);
+	if (ok)
+		win = portfolio_pick(engines);
+	i = 0;
+	while (win != NULL && i < win->ps.out.len)
+		apply_op(ps, win->ps.out.buf[i++]);
+	i = 0;
+	while (i < ENGINES)
+		engine_free(&engines[i++]);
+	return (win != NULL);
+}
+
+//Portfolio for the large stacks: the chunk sort around the size ft_chunks
+//picks, the radix and the LIS insertion run side by side, one thread each,
+//on their own copy of the stacks. The shortest finished output is replayed
+//on ps, so the caller sees the same stacks and output as with one engine.
+//An engine that can not get a thread runs in place.
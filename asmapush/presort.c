@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   presort.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/18 09:50:27 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/18 09:50:27 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+int	count_breaks(t_stack *stackA)
+{
+	t_list	*node;
+	int		breaks;
+
+	breaks = 0;
+	node = stackA->top;
+	while (node != NULL && node->next != NULL)
+	{
+		if (node->next->index != node->index + 1
+			&& node->next->index != node->index - 1)
+			breaks++;
+		node = node->next;
+	}
+	return (breaks);
+}
+
+int	rotated_sorted(t_stack *stackA)
+{
+	t_list	*node;
+
+	node = stackA->top;
+	while (node->next != NULL)
+	{
+		if (node->next->index != node->index % stackA->size + 1)
+			return (0);
+		node = node->next;
+	}
+	return (stackA->top->index == node->index % stackA->size + 1);
+}
+
+void	sort_rotate(t_ps *ps)
+{
+	int	pos;
+
+	pos = stack_pos(&ps->a, 1);
+	if (pos <= ps->a.size / 2)
+		while (pos-- > 0)
+			ra(ps);
+	else
+		while (pos++ < ps->a.size)
+			rra(ps);
+}
+
+//count_breaks: neighbours that are not consecutive ranks (either way).
+//A random input breaks almost everywhere, a sorted input with a few swaps
+//or shuffled blocks only a few times, a reversed one never.
+//rotated_sorted / sort_rotate: A is a rotation of the sorted order, so
+//bringing rank 1 to the top by the shorter way is enough.
@@ -6,7 +6,7 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 11:35:27 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:21:28 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 11:48:09 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -36,42 +36,29 @@ void	printindex(t_list *lst)
 	}
 }
 
-void	sort(t_list **stackA, t_list **stackB)
-{
-	int	length;
-
-	length = ft_lstsize(*stackA);
-	if (length == 2)
-		sort2na(stackA);
-	if (length == 3)
-		sort3n(stackA);
-	if (length == 4)
-		sort4n(stackA, stackB);
-	if (length == 5)
-		sort5n(stackA, stackB);
-	if (length > 5)
-		sort100n(stackA, stackB);
-}
-
 int	main(int ac, char **av)
 {
-	t_list	*stacka;
-	t_list	*stackb;
+	t_ps	ps;
+	int		flags;
 
-	stacka = NULL;
-	stackb = NULL;
+	ft_bzero(&ps, sizeof(t_ps));
+	flags = read_flags(&ps, av);
+	av += flags;
+	ac -= flags;
 	if (ac == 1)
-	{
 		exit(1);
-	}
-	pars(&stacka, av);// check if there is no unvalied number  // no duplicate numbers.
-	if (sorted(&stacka))  
+	if (!pars(&ps, av))// check if there is no unvalied number  // no duplicate numbers.
+		free_exit(&ps, 1);
+	if (sorted(&ps.a))  
 	{
-		ft_lstclear(&stacka, free); // if its sorted  , free the memory allocaed 
+		ps_free(&ps); // if its sorted  , free the memory allocaed 
 		exit(1);
 	}
-	fill_index(&stacka);
-	sort(&stacka, &stackb);
-	ft_lstclear(&stacka, free);
+	if (!fill_index(&ps.a) || !stack_track(&ps.a, ps.a.size)
+		|| !stack_track(&ps.b, ps.a.size) || !sort(&ps)
+		|| (ps.pack && !pack_ops(&ps, ps.a.size)))
+		free_exit(&ps, 1);
+	flush_ops(&ps);
+	free_exit(&ps, 0);
 	return (0);
 }
@@ -16,41 +16,293 @@
 # include "libft/libft.h"
 # include <stdio.h>
 # include <stdlib.h>
+# include <stdint.h>
+# include <pthread.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
 
-void	sa(t_list **stackA);
-void	pb(t_list **stackA, t_list **stackB);
-void	ra(t_list **stackA);
-void	rra(t_list **stackA);
-void	sb(t_list **stackB);
-void	pa(t_list **stackB, t_list **stackA);
-void	rb(t_list **stackB);
-void	rrb(t_list **stackB);
-void	sort2na(t_list **stackA);
-void	sort3n(t_list **stackA);
-void	sort4n(t_list **stackA, t_list **stackB);
-void	sort5n(t_list **stackA, t_list **stackB);
-int		find_min(t_list **stackA);
-int		find_min_index(t_list **stackA);
-int		find_max(t_list **stackA);
-int		find_max_index(t_list **stackA);
-int		find_length_min(t_list **stackB);
-int		find_length_index(t_list **stackA, int index);
-void	fill_index(t_list **stackA);
-int		sorted(t_list **stackA);
-void	pback(t_list **stackA, t_list **stackB);
-int		cheak_its_swap(t_list **stackB);
-void	free_2d(char **x);
-void	exit_any(t_list **stackA, char *s, char **x);
+# define SMALL_MAX 6
+# define BEAM_MAX 20
+# define BEAM_WIDTH 2048
+# define BEAM_DEPTH 192
+# define BEAM_THREADS 4
+# define BEAM_TT 2097152
+# define BEAM_HMAX 127
+# define CHECKER_BUF 65536
+# define OUT_BUF 65536
+# define IN_BUF 1048576
+# define PACK_MAGIC 0x315a5350
+# define PACK_FRAMES 0x31465350
+# define PACK_REP 11
+# define PACK_LONG 12
+# define PACK_MIX 13
+# define RADIX_MIN 500
+# define RADIX_BREAKS 8
+# define LIS_FLAG "--lis"
+# define PACK_FLAG "--pack"
+# define LIS_RATIO 4
+# define ENGINES 6
+# define PORTFOLIO_MAX 20000
+
+typedef enum e_op
+{
+	OP_SA,
+	OP_SB,
+	OP_SS,
+	OP_PA,
+	OP_PB,
+	OP_RA,
+	OP_RB,
+	OP_RR,
+	OP_RRA,
+	OP_RRB,
+	OP_RRR
+}	t_op;
+
+// A stack is a doubly linked list of t_list nodes with both ends at hand,
+// so pushes and rotations in either direction are O(1). key, in, min and
+// max track ranks once stack_track has run (see stack_track.c).
+typedef struct s_stack
+{
+	t_list			*top;
+	t_list			*bottom;
+	int				size;
+	int				*key;
+	char			*in;
+	int				min;
+	int				max;
+	int				cap;
+}	t_stack;
+
+// Operations are recorded as t_op bytes and written out in one go.
+typedef struct s_ops
+{
+	unsigned char	*buf;
+	size_t			len;
+	size_t			cap;
+}	t_ops;
+
+typedef struct s_ps
+{
+	t_stack			a;
+	t_stack			b;
+	t_ops			out;
+	t_list			*nodes;
+	int				breaks;
+	int				lis;
+	int				pack;
+	size_t			*best;
+	int				stop;
+}	t_ps;
+
+typedef enum e_kind
+{
+	ENGINE_CHUNK,
+	ENGINE_RADIX,
+	ENGINE_LIS
+}	t_kind;
+
+// One portfolio entry: its own copy of the stacks and of the output,
+// best points to the shortest finished output so far.
+typedef struct s_engine
+{
+	t_ps			ps;
+	t_kind			kind;
+	int				arg;
+	pthread_t		thread;
+	int				started;
+}	t_engine;
+
+// LIS mode: a move brings B's node to the top and A's target above it.
+// a and b are rotations, negative for the reverse way.
+typedef struct s_move
+{
+	int				a;
+	int				b;
+	int				cost;
+	int				rank;
+}	t_move;
+
+// keep marks the ranks that stay in A, tree is a Fenwick tree over the
+// ranks held by A, top the largest power of two <= n.
+typedef struct s_lis
+{
+	char			*keep;
+	int				*tree;
+	int				n;
+	int				top;
+	int				len;
+	t_move			best;
+}	t_lis;
+
+// One search state: ranks of A (top first) followed by ranks of B.
+typedef struct s_bnode
+{
+	uint64_t		key;
+	int				slot;
+	unsigned short	h;
+	unsigned char	op;
+	unsigned char	la;
+	unsigned char	s[BEAM_MAX];
+}	t_bnode;
+
+typedef struct s_beam
+{
+	int				n;
+	int				count;
+	int				depth;
+	t_bnode			*cur;
+	t_bnode			*cand;
+	int				*trail;
+	uint64_t		*keys;
+	uint64_t		*vals;
+	pthread_mutex_t	lock;
+	pthread_cond_t	go;
+	pthread_cond_t	done;
+	int				round;
+	int				pending;
+	int				stop;
+}	t_beam;
+
+typedef struct s_ring
+{
+	int				*buf;
+	int				cap;
+	int				head;
+	int				size;
+}	t_ring;
+
+// Packed output (pack_ops.c): a byte buffer written or read one nibble at
+// a time, with the last two different ops as shared state.
+typedef struct s_pack
+{
+	unsigned char	*buf;
+	size_t			len;
+	size_t			cap;
+	size_t			pos;
+	int				half;
+	int				last;
+	int				prev;
+}	t_pack;
+
+typedef struct s_replay
+{
+	t_pack			pk;
+	t_ops			ops;
+	int				*ranks;
+	unsigned char	*frame;
+	int				n;
+	int				width;
+	t_ring			a;
+	t_ring			b;
+}	t_replay;
+
+typedef struct s_worker
+{
+	t_beam			*beam;
+	int				id;
+	pthread_t		thread;
+}	t_worker;
+
+void	sa(t_ps *ps);
+void	pb(t_ps *ps);
+void	ra(t_ps *ps);
+void	rra(t_ps *ps);
+void	sb(t_ps *ps);
+void	pa(t_ps *ps);
+void	rb(t_ps *ps);
+void	rrb(t_ps *ps);
+void	ss(t_ps *ps);
+void	rr(t_ps *ps);
+void	rrr(t_ps *ps);
+void	stack_add_top(t_stack *stack, t_list *node);
+t_list	*stack_pop(t_stack *stack);
+void	stack_swap(t_stack *stack);
+void	stack_rotate(t_stack *stack);
+void	stack_rrotate(t_stack *stack);
+int		stack_track(t_stack *stack, int cap);
+void	track_top(t_stack *stack, t_list *node);
+void	track_in(t_stack *stack, t_list *node);
+void	track_out(t_stack *stack, t_list *node);
+int		stack_pos(t_stack *stack, int index);
+void	emit(t_ps *ps, int op);
+void	flush_ops(t_ps *ps);
+void	apply_op(t_ps *ps, int op);
+int		op_apply(t_ps *ps, int op);
+int		op_inverse(int op);
+int		small_code(t_stack *stackA, int n);
+void	sort_small(t_ps *ps);
+const char	*small_table(int n, int code);
+int		sort_beam(t_ps *ps);
+int		beam_search(t_beam *beam, unsigned char *ops);
+int		beam_select(t_beam *beam);
+void	beam_expand(t_beam *beam, int id);
+int		beam_apply(t_bnode *node, int n, int op);
+void	beam_score(t_bnode *node, int n);
+uint64_t	beam_hash(t_bnode *node, int n);
+int		tt_claim(t_beam *beam, uint64_t key, int id);
+int		tt_owner(t_beam *beam, t_bnode *node, int id);
+int		pool_start(t_beam *beam, t_worker *workers);
+void	pool_round(t_beam *beam);
+void	pool_stop(t_beam *beam, t_worker *workers, int count);
+int		find_min(t_stack *stackA);
+int		find_min_index(t_stack *stackA);
+int		find_max(t_stack *stackA);
+int		find_max_index(t_stack *stackA);
+int		find_length_min(t_stack *stackB);
+int		find_length_index(t_stack *stackA, int index);
+int		fill_index(t_stack *stackA);
+int		sorted(t_stack *stackA);
+void	pback(t_ps *ps);
+void	ps_free(t_ps *ps);
+void	free_exit(t_ps *ps, int error);
 void	error_exit(char *arg_str);
-char	*join_everthing(char **av);
-void	check_double_sign(char *arg_str);
-void	pars_help(t_list **stackA, char *arg_str, char **x);
-int		pars(t_list **stackA, char **av);
+int		*parse_args(char **av, int *count);
+int		read_flags(t_ps *ps, char **av);
+int		*input_values(char **av, int *count);
+int		*read_bin(char *path, int *count);
+char	*read_all(int fd, size_t *out);
+int		pack_byte(t_pack *pk, int byte);
+int		pack_head(t_pack *pk, t_ps *ps, int count);
+int		pack_uint(t_pack *pk, uint32_t value, int bytes);
+int		pack_nib(t_pack *pk, int nib);
+void	pack_seen(t_pack *pk, int op);
+int		pack_ops(t_ps *ps, int count);
+int		unpack_ops(t_pack *pk, t_ops *ops);
+int		replay_frames(t_replay *rp, int stride);
+int		pars(t_ps *ps, char **av);
+t_list	*nodes_fill(t_stack *stack, int *values, int count);
+t_list	*nodes_copy(t_stack *dst, t_stack *src);
+void	merge_sort(int *arr, int *tmp, int n);
+int		has_duplicates(int *values, int count);
+int		ring_init(t_ring *ring, int cap, int *values, int size);
+void	ring_swap(t_ring *ring);
+void	ring_push(t_ring *dst, t_ring *src);
+void	ring_rotate(t_ring *ring);
+void	ring_rrotate(t_ring *ring);
+void	ring_apply(t_ring *a, t_ring *b, int op);
+int		read_ops(t_ring *a, t_ring *b);
 void	printlist(t_list *lst);
 void	printindex(t_list *lst);
-void	sort(t_list **stackA, t_list **stackB);
-void	sort100n(t_list **stackA, t_list **stackB);
-void	cheak_doubls(t_list **stackA);
-int		ft_chunks(t_list **stackA);
+int		sort(t_ps *ps);
+void	sort100n(t_ps *ps);
+void	sort_chunk(t_ps *ps, int chnk);
+int		ft_chunks(t_stack *stackA, int breaks);
+int		count_breaks(t_stack *stackA);
+int		rotated_sorted(t_stack *stackA);
+void	sort_rotate(t_ps *ps);
+void	sort_radix(t_ps *ps);
+int		lis_keep(t_stack *stackA, t_lis *lis);
+void	lis_add(t_lis *lis, int rank);
+int		lis_next(t_lis *lis, int rank);
+void	move_best(t_ps *ps, t_lis *lis, t_list *node, int pos);
+void	move_apply(t_ps *ps, t_move *move);
+void	sort_lis(t_ps *ps, t_lis *lis);
+void	lis_free(t_lis *lis);
+int		engine_init(t_engine *engine, t_ps *src, t_kind kind, int arg);
+void	*engine_main(void *arg);
+void	engine_free(t_engine *engine);
+int		sort_portfolio(t_ps *ps);
 
 #endif
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/13 12:02:19 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/20 11:08:40 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	bit_width(int size)
+{
+	int	bits;
+
+	bits = 0;
+	while (((size - 1) >> bits) != 0)
+		bits++;
+	return (bits);
+}
+
+static int	partitioned(t_stack *stackA, int bit)
+{
+	t_list	*node;
+	int		seen_one;
+
+	seen_one = 0;
+	node = stackA->top;
+	while (node != NULL)
+	{
+		if (((node->index - 1) >> bit) & 1)
+			seen_one = 1;
+		else if (seen_one)
+			return (0);
+		node = node->next;
+	}
+	return (1);
+}
+
+static void	radix_pass(t_ps *ps, int bit)
+{
+	int	count;
+
+	count = ps->a.size;
+	while (count-- > 0 && !ps->stop)
+	{
+		if (((ps->a.top->index - 1) >> bit) & 1)
+			ra(ps);
+		else
+			pb(ps);
+	}
+	while (ps->b.size > 0 && !ps->stop)
+		pa(ps);
+}
+
+void	sort_radix(t_ps *ps)
+{
+	int	bits;
+	int	bit;
+
+	bits = bit_width(ps->a.size);
+	bit = -1;
+	while (++bit < bits && !ps->stop && !sorted(&ps->a))
+		if (!partitioned(&ps->a, bit))
+			radix_pass(ps, bit);
+}
+
+//LSD binary radix over the ranks 0..n-1 (index - 1), lowest bit first.
+//One pass pushes every rank with the bit clear to B and rotates the others,
+//then brings B back: pb keeps B in reverse and pa reverses it again, so the
+//pass is stable. A plane with all clear bits above all set bits is already
+//partitioned and skipped. Cost: at most n + n/2 moves per bit, O(n log n).
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/25 17:15:20 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/25 17:15:20 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static uint32_t	get_uint(unsigned char *p, int bytes)
+{
+	uint32_t	value;
+
+	value = 0;
+	while (bytes-- > 0)
+		value = value << 8 | p[bytes];
+	return (value);
+}
+
+static int	read_header(t_replay *rp, unsigned char *data, size_t len)
+{
+	size_t	i;
+
+	if (len < 13 || get_uint(data, 4) != PACK_MAGIC)
+		return (0);
+	rp->n = get_uint(data + 4, 4);
+	rp->width = data[8];
+	if (rp->n < 1 || rp->n > INT_MAX / 4 || (rp->width != 2 && rp->width != 4)
+		|| len - 13 < (size_t)rp->n * rp->width)
+		return (0);
+	rp->ranks = malloc(sizeof(int) * rp->n);
+	if (rp->ranks == NULL)
+		return (0);
+	i = -1;
+	while (++i < (size_t)rp->n)
+		rp->ranks[i] = get_uint(data + 9 + i * rp->width, rp->width);
+	rp->pk.buf = data + 9 + i * rp->width;
+	rp->pk.len = len - 13 - i * rp->width;
+	rp->ops.cap = get_uint(rp->pk.buf, 4);
+	rp->pk.buf += 4;
+	rp->ops.buf = malloc(rp->ops.cap + 1);
+	return (rp->ops.buf != NULL);
+}
+
+static int	replay_load(t_replay *rp)
+{
+	unsigned char	*data;
+	size_t			len;
+	int				ok;
+
+	data = (unsigned char *)read_all(0, &len);
+	if (data == NULL)
+		return (0);
+	ok = read_header(rp, data, len) && unpack_ops(&rp->pk, &rp->ops);
+	free(data);
+	return (ok);
+}
+
+static void	replay_free(t_replay *rp, int error)
+{
+	free(rp->ops.buf);
+	free(rp->ranks);
+	free(rp->frame);
+	free(rp->a.buf);
+	free(rp->b.buf);
+	if (error)
+		error_exit(NULL);
+}
+
+int	main(int ac, char **av)
+{
+	t_replay	rp;
+	t_ps		ps;
+	int			*stride;
+	int			count;
+
+	ft_bzero(&rp, sizeof(t_replay));
+	stride = NULL;
+	if (ac == 3 && ft_strncmp(av[1], "--frames", 9) == 0)
+		stride = parse_args(av + 1, &count);
+	if ((ac != 1 && (stride == NULL || count != 1 || *stride < 1))
+		|| !replay_load(&rp)
+		|| (stride != NULL && !replay_frames(&rp, *stride)))
+	{
+		free(stride);
+		replay_free(&rp, 1);
+	}
+	free(stride);
+	if (ac == 1)
+	{
+		ft_bzero(&ps, sizeof(t_ps));
+		ps.out = rp.ops;
+		flush_ops(&ps);
+	}
+	replay_free(&rp, 0);
+	return (0);
+}
+
+//replay: reads a --pack archive on stdin.
+//  replay                 prints the operations as text, like push_swap
+//  replay --frames <k>    writes the stacks every k operations instead
+//(see replay_frames.c).
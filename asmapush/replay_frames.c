@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_frames.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/25 18:01:44 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/25 18:01:44 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	replay_ranks(t_replay *rp)
+{
+	int	i;
+
+	rp->frame = malloc(13 + (size_t)rp->n * rp->width);
+	if (rp->frame == NULL)
+		return (0);
+	i = -1;
+	while (++i < rp->n)
+		if (rp->ranks[i] < 0 || rp->ranks[i] >= rp->n)
+			return (0);
+	return (ring_init(&rp->a, rp->n, rp->ranks, rp->n)
+		&& ring_init(&rp->b, rp->n, NULL, 0));
+}
+
+static void	put_ring(unsigned char **p, t_ring *ring, int width)
+{
+	int	i;
+	int	k;
+	int	rank;
+
+	i = -1;
+	while (++i < ring->size)
+	{
+		rank = ring->buf[(ring->head + i) % ring->cap];
+		k = -1;
+		while (++k < width)
+			*(*p)++ = rank >> (8 * k) & 0xff;
+	}
+}
+
+static void	put_u32(unsigned char **p, uint32_t value)
+{
+	int	k;
+
+	k = -1;
+	while (++k < 4)
+		*(*p)++ = value >> (8 * k) & 0xff;
+}
+
+static void	put_frame(t_replay *rp, unsigned char *frame, size_t step)
+{
+	unsigned char	*p;
+
+	p = frame;
+	put_u32(&p, step);
+	put_u32(&p, rp->a.size);
+	put_ring(&p, &rp->a, rp->width);
+	put_ring(&p, &rp->b, rp->width);
+	write(1, frame, p - frame);
+}
+
+int	replay_frames(t_replay *rp, int stride)
+{
+	unsigned char	*p;
+	size_t			i;
+
+	if (!replay_ranks(rp))
+		return (0);
+	p = rp->frame;
+	put_u32(&p, PACK_FRAMES);
+	put_u32(&p, rp->n);
+	put_u32(&p, stride);
+	*p = rp->width;
+	write(1, rp->frame, 13);
+	i = -1;
+	while (++i <= rp->ops.len)
+	{
+		if (i % stride == 0 || i == rp->ops.len)
+			put_frame(rp, rp->frame, i);
+		if (i < rp->ops.len)
+			ring_apply(&rp->a, &rp->b, rp->ops.buf[i]);
+	}
+	return (1);
+}
+
+//--frames output, little-endian: u32 PACK_FRAMES, u32 n, u32 stride,
+//u8 width (as in the archive), then one frame every stride operations and
+//one after the last: u32 step, u32 size of A, and the ranks of A then B,
+//top first, width bytes each.
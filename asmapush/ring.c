@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/09 15:12:08 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/09 15:12:08 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+int	ring_init(t_ring *ring, int cap, int *values, int size)
+{
+	ring->buf = malloc(sizeof(int) * (cap + (cap == 0)));
+	ring->cap = cap;
+	ring->head = 0;
+	ring->size = size;
+	if (ring->buf == NULL)
+		return (0);
+	if (size > 0)
+		ft_memcpy(ring->buf, values, sizeof(int) * size);
+	return (1);
+}
+
+void	ring_swap(t_ring *ring)
+{
+	int	next;
+	int	tmp;
+
+	if (ring->size < 2)
+		return ;
+	next = ring->head + 1;
+	if (next == ring->cap)
+		next = 0;
+	tmp = ring->buf[ring->head];
+	ring->buf[ring->head] = ring->buf[next];
+	ring->buf[next] = tmp;
+}
+
+void	ring_push(t_ring *dst, t_ring *src)
+{
+	if (src->size == 0)
+		return ;
+	if (--dst->head < 0)
+		dst->head = dst->cap - 1;
+	dst->buf[dst->head] = src->buf[src->head];
+	dst->size++;
+	if (++src->head == src->cap)
+		src->head = 0;
+	src->size--;
+}
+
+void	ring_rotate(t_ring *ring)
+{
+	int	tail;
+
+	if (ring->size < 2)
+		return ;
+	tail = ring->head + ring->size;
+	if (tail >= ring->cap)
+		tail -= ring->cap;
+	ring->buf[tail] = ring->buf[ring->head];
+	if (++ring->head == ring->cap)
+		ring->head = 0;
+}
+
+void	ring_rrotate(t_ring *ring)
+{
+	int	last;
+
+	if (ring->size < 2)
+		return ;
+	last = ring->head + ring->size - 1;
+	if (last >= ring->cap)
+		last -= ring->cap;
+	if (--ring->head < 0)
+		ring->head = ring->cap - 1;
+	ring->buf[ring->head] = ring->buf[last];
+}
+
+//Array model of a stack for the checker: buf is a circular buffer of cap
+//slots, the top is buf[head] and the next size - 1 slots follow it.
+//Rotations only move the head, so every operation is O(1).
@@ -0,0 +1,172 @@
+/* Generated by tools/gen_small.c (make table). Do not edit. */
+
+#include "push_swap.h"
+
+const char	*small_table(int n, int code)
+{
+	static const char	*t2[2] = {
+		"", "a",};
+
+	static const char	*t3[6] = {
+		"", "af", "a", "i", "f", "ai",};
+
+	static const char	*t4[24] = {
+		"", "eafd", "ead", "ia", "af", "eaid", "a", "aeafd", "eada",
+		"i", "afa", "aiaf", "aead", "aia", "aeada", "ai", "ff", "ffa",
+		"f", "fead", "fa", "iaf", "aff", "affa",};
+
+	static const char	*t5[120] = {
+		"", "iiaff", "eeadd", "eiad", "eafd", "eeaidd", "ead", "eaeafdd",
+		"iiafa", "ia", "eafad", "eaiafd", "aiaff", "eaiad", "aiaiiai",
+		"eaid", "afaf", "effad", "af", "aiiaii", "efad", "aiafa", "eaffd",
+		"eaffad", "a", "aiiaff", "eecdd", "aeiad", "aeafd", "eeakdd",
+		"eada", "eaeahdd", "iiaf", "i", "eiadi", "ffaff", "aiaffa",
+		"eaekdd", "faffaf", "eadi", "iai", "ieiad", "afa", "efecdd",
+		"efada", "aiaf", "eaidi", "eaffada", "aead", "eeahdad", "aiiafa",
+		"aia", "aeafad", "eecdid", "aeada", "eeakddi", "aiiaf", "ai",
+		"aeiadi", "affaff", "eiadii", "ffaf", "eiadiia", "eadai", "ii",
+		"iia", "iaii", "feafdf", "iaiia", "aeaidf", "faff", "faffa",
+		"iaff", "feafd", "iaiiai", "aeaid", "faf", "fefad", "iaffa",
+		"faeafd", "afaffaf", "aeadi", "aiai", "aieiad", "aeiadii", "affaf",
+		"aeiadiia", "aeadai", "aii", "aiia", "ff", "iiai", "ffa", "iafaf",
+		"eadaii", "ieffad", "f", "iiaii", "fead", "iafa", "eafdf", "aeaffad",
+		"fa", "feecdd", "feada", "iaf", "aeaidi", "eaiafdf", "aiaii",
+		"eaiadf", "aiaiia", "eaidf", "afaff", "afaffa", "aff", "aiiai",
+		"affa", "aiafaf", "eaffdf", "aieffad",};
+
+	static const char	*t6[720] = {
+		"", "iiaff", "eeeaddd", "eeiadd", "eeafdd", "eeeaiddd", "eeadd",
+		"ffaffaff", "eiiafad", "eiad", "eeafadd", "eeaiafdd", "eaiaffd",
+		"eeaiadd", "eaiaiiaid", "eeaidd", "eafafd", "eeffadd", "eafd",
+		"eaiiaiid", "eefadd", "eaiafad", "eeaffdd", "eeaffadd", "ead",
+		"eadiiaff", "eeecddd", "eaeiadd", "eaeafdd", "eeeciddd", "eeadad",
+		"eeaecfddd", "iiafa", "ia", "eeiadid", "effaffd", "eaiaffad",
+		"eeaiadad", "efaffafd", "eeadid", "eiaid", "eieiadd", "eafad",
+		"eefecddd", "eefadad", "eaiafd", "eeaidid", "eeaffadad", "eaeadd",
+		"aeiiadfff", "eaiiafad", "eaiad", "eaeafadd", "eeecdidd", "eaeadad",
+		"eeeciddid", "eaiiafd", "eaid", "eaeiadid", "eaffaffd", "aiefafdf",
+		"effafd", "eeiadiiad", "eeadaid", "eiid", "eiiad", "eiaiid",
+		"efeafdfd", "eiaiiad", "eaeaidfd", "efaffd", "efaffad", "aiaff",
+		"efeafdd", "aiaiiaii", "eaeaidd", "efafd", "efefadd", "eiaffad",
+		"efaeafdd", "aeiiadffa", "eaeadid", "eaiaid", "eaieiadd", "aeaiafdff",
+		"eaffafd", "aiaieiiadi", "eaeadaid", "eaiid", "eaiiad", "afaf",
+		"eiiaid", "effad", "eiafafd", "eeadaiid", "eieffadd", "af",
+		"aiiafff", "efeadd", "eiafad", "eeafdfd", "aieiiadii", "efad",
+		"aiiaiiai", "efeadad", "aiafa", "eaeaidid", "aieiiaidi", "eaiaiid",
+		"eeaiadfd", "eaiaiiad", "eeaidfd", "eafaffd", "eafaffad", "eaffd",
+		"eaiiaid", "eaffad", "eaiafafd", "eeaffdfd", "eaieffadd", "a",
+		"aiiaff", "eefakdd", "eeicdd", "eeahdd", "aeeeaiddd", "eecdd",
+		"affaffaff", "aeiiafad", "aeiad", "eeafcdd", "eeaiahdd", "aeaiaffd",
+		"eeaicdd", "eaiaiiadi", "eeakdd", "eefhdd", "eeffcdd", "aeafd",
+		"eaiiaidi", "eefcdd", "eeiahdd", "eeafhdd", "eeaffcdd", "eada",
+		"eeeahddd", "eefaddi", "eaeicdd", "eaeahdd", "eeehaddd", "eeadada",
+		"fffeaffd", "iiaf", "i", "eeiaddi", "fffaff", "eeafaddi", "eefehddd",
+		"ffaffaf", "eeaddi", "eiadi", "eieicdd", "eafada", "eeffaddi",
+		"eeaiaddi", "eadaiaf", "eeaiddi", "ffeaffdf", "eaecdd", "eeeahdadd",
+		"eeecdcdd", "eaekdd", "eaeafcdd", "eeecdkdd", "eaeadada", "eeecidddi",
+		"eadiiaf", "eadi", "eaeiaddi", "faffaff", "ieiaidf", "iaiiaf",
+		"iieiafad", "eeadadi", "iai", "ieiad", "eiaidi", "eieiaddi",
+		"eiaiekdd", "eaecdidf", "eeadidi", "efaffada", "aiaffa", "efeahdd",
+		"eiaiiadi", "eaeakdd", "efafda", "efefcdd", "eiaffada", "efaeahdd",
+		"aeiiadff", "aeiidff", "eaiadi", "eaieicdd", "eaeiadidi", "eaffafda",
+		"feaffadff", "eaeadadi", "eaidi", "eaiekdd", "afafa", "eiiadi",
+		"effada", "aiefafd", "eeadaidi", "eieffcdd", "afa", "eiiaidi",
+		"efecdd", "eiafada", "eaeafhdd", "eaeaffcdd", "efada", "efefaddi",
+		"aiiafaf", "aiaf", "eaeaiddi", "fefaffdf", "eaiaidi", "eaieiaddi",
+		"aiieiiaid", "eecdidf", "aeiaidf", "aieiafad", "eaffda", "eaiiadi",
+		"eaffada", "aeaiafdf", "eeakdidf", "eaieffcdd", "aead", "eeekaddd",
+		"eefcdid", "eeekddd", "eeahdad", "eeeakddd", "eecdad", "eeaekaddd",
+		"aiiafa", "aia", "eeicdid", "fefaffd", "eaiaidii", "eeaekddd",
+		"feaffafd", "eecdid", "aeiaid", "aeieiadd", "aeafad", "eaiiadii",
+		"eefcdad", "aeaiafd", "eeakdid", "eeaffcdad", "aeada", "aeeeahddd",
+		"eefcddi", "aeaeicdd", "aeaeahdd", "eeeckddd", "eeahddi", "afffeaffd",
+		"aiiaf", "ai", "eeicddi", "afffaff", "eeafcddi", "eehehddd",
+		"affaffaf", "eecddi", "aeiadi", "aeieicdd", "aeafada", "eeffcddi",
+		"eeaicddi", "aeadaiaf", "eeakddi", "affeaffdf", "eaecdad", "eeehaddid",
+		"ffefafd", "eadaia", "eaeicdid", "ffeaffd", "eaeahddi", "eeehadddi",
+		"eadaiiaf", "eadai", "eaeicddi", "eefaddii", "ieiidf", "fffaf",
+		"ieiiadf", "fffafa", "ii", "iia", "eiadii", "ffeafdf", "eiadiia",
+		"eieicdid", "ffaff", "ffaffa", "eiaidii", "efeahdad", "eiaiekddi",
+		"eaecdid", "eaekdid", "efefcdad", "eiaidiia", "ffeefcdd", "aeaiiadff",
+		"eaecddi", "eaekddi", "eaieekddd", "faffeafd", "faffaf", "faffaeafd",
+		"faffafa", "eadii", "eadiia", "iaii", "ieiadi", "iaiia", "ieiaid",
+		"feafdff", "feafdffa", "afaead", "eiiadii", "efecdad", "aeaiadf",
+		"eaeakdid", "eieffcddi", "afaeada", "efefcddi", "aiieffad",
+		"aeaidf", "eaeakddi", "eefcdiidf", "eaiadii", "fefafdf", "eaiadiia",
+		"eecdaidf", "aeiidf", "aeiiadf", "eaidii", "eaiekddi", "eaidiia",
+		"eaiekdid", "feaffdf", "feaffadf", "aeaeadd", "eiiadfff", "eefcdaid",
+		"aeaiad", "eeakdiid", "feeaffdd", "aeaeadad", "eeeakddid", "aeaiiafd",
+		"aeaid", "eeekddid", "eefcdiid", "iefafdf", "fefafd", "eaiadiiai",
+		"eecdaid", "aeiid", "aeiiad", "iaffaf", "feeafdfd", "aeiaiiad",
+		"aeaeaidfd", "feaffd", "feaffad", "aeaecdd", "eaiiadfff", "eefcdadi",
+		"aeaekdd", "eeakdidi", "feeafhdd", "eeahdadi", "eeeakdddi",
+		"aeadiiaf", "aeadi", "eeekdddi", "afaffaff", "aieiaidf", "aiaiiaf",
+		"aiieiafad", "eecdadi", "aiai", "aieiad", "aeiaidi", "aeieiaddi",
+		"aeiaiekdd", "aeaecdidf", "eecdidi", "feaffada", "aeaecdad",
+		"eeeckddid", "affefafd", "aeadaia", "eeakddii", "affeaffd",
+		"aeaeahddi", "eeeckdddi", "aeadaiiaf", "aeadai", "aeaeicddi",
+		"eefcddii", "aieiidf", "afffaf", "aieiiadf", "afffafa", "aii",
+		"aiia", "aeiadii", "affeafdf", "aeiadiia", "aeieicdid", "affaff",
+		"affaffa", "iafaff", "ffeafd", "eiadiiai", "ffeafad", "ffaf",
+		"ffefad", "iafaffa", "ffaeafd", "eiadieiid", "eaecdadi", "ffafa",
+		"ffefada", "eaeicddii", "eafdffaf", "eaeicddiia", "eaeahddii",
+		"eadaii", "eadaiia", "fff", "iiai", "fffa", "ieiid", "iieiad",
+		"ieiiad", "iafff", "ieiadii", "iaiiai", "ieiaidi", "feafdf",
+		"faeaffad", "iafffa", "ieiadiia", "iaieiid", "ieiaiid", "feafadf",
+		"faeaffada", "eaekddii", "aeaffafdf", "iaieiiad", "ieiaiiad",
+		"aeaiidf", "aeaiiadf", "faff", "eadiiai", "faffa", "iefaffd",
+		"faffaead", "iefaffad", "iaff", "feeafdd", "iaiiaii", "aeaeaidd",
+		"feafd", "feefadd", "iaffead", "feaeafdd", "eiiadffa", "eiaidff",
+		"feafad", "feefadad", "eaiafdff", "aeaffafd", "iaieiiadi", "aeaeadaid",
+		"aeaiid", "aeaiiad", "faf", "aeiiaid", "fefad", "iefafda", "eeahdffd",
+		"iefefcdd", "iaffa", "feeahdd", "iaiiaiia", "aeaeakdd", "faeafd",
+		"feefcdd", "iaffeada", "feaeahdd", "eiiadff", "eiidff", "aeaiadi",
+		"effafdff", "eaiafdffa", "aeaffafda", "efaffadff", "efaffdff",
+		"aeaidi", "aeaiekdd", "fafa", "aeiiadi", "fefada", "iefafd",
+		"eecdaidi", "iefefadd", "aeiaidii", "feeahdad", "eaiiadffa",
+		"aeaecdid", "faeafad", "feefcdad", "aeiaidiia", "affeefcdd",
+		"eaiiadff", "eaiidff", "aeaekddi", "eaffafdff", "afaffeafd",
+		"afaffaf", "afaffaeafd", "afaffafa", "aeadii", "aeadiia", "aiaii",
+		"aieiadi", "aiaiia", "aieiaid", "efafdff", "efafdffa", "aiafaff",
+		"affeafd", "aeiadiiai", "affeafad", "affaf", "affefad", "aiafaffa",
+		"affaeafd", "aeiadieiid", "aeaecdadi", "affafa", "affefada",
+		"aeaeicddii", "eaffadff", "eeeckdddii", "eaffadffa", "aeadaii",
+		"aeadaiia", "afff", "aiiai", "afffa", "aieiid", "aiieiad", "aieiiad",
+		"ff", "iiaii", "ffead", "iafafa", "iieiadi", "ieiiadi", "ffa",
+		"iiaiia", "ffeada", "iafaf", "iieiaid", "ieiiaid", "ffaead",
+		"ieffada", "ffaeada", "ieffad", "eafafdff", "ieiafafd", "eafdff",
+		"eadaiiai", "eafdffa", "eadaieiid", "eeaffddff", "ieieffadd",
+		"f", "iiafff", "feeadd", "aeiafad", "eeafddf", "ieiiadii", "fead",
+		"iiaiiai", "feeadad", "iafa", "eeafaddf", "ieiiaidi", "feaeadd",
+		"eeaiaddf", "feaeadad", "eeaiddf", "eafafdf", "eeffaddf", "eafdf",
+		"aeaiiaid", "aeaffad", "eaiafadf", "eeaffddf", "eeaffaddf",
+		"fa", "iiafffa", "feecdd", "aeiafada", "eaeafddf", "eeeakdhdd",
+		"feada", "feefaddi", "iiafaf", "iaf", "eeiadidf", "effaffdf",
+		"feaecdd", "eeaekdhdd", "iieiiaid", "eeadidf", "eiaidf", "ieiafad",
+		"eafadf", "aeaiiadi", "aeaffada", "eaiafdf", "eeaididf", "aeaieffcdd",
+		"faead", "aeiiadii", "feecdad", "eaiadf", "aeaeakdid", "eeecdiddf",
+		"faeada", "feefcddi", "iieffad", "eaidf", "aeaeakddi", "eaffaffdf",
+		"aeaiadii", "effafdf", "aeaiadiia", "eeadaidf", "eiidf", "eiiadf",
+		"aeaidii", "aeaiekddi", "aeaidiia", "aeaiekdid", "efaffdf",
+		"efaffadf", "aiafff", "aieiadii", "aiaiiai", "aieiaidi", "efafdf",
+		"efefaddf", "aiafffa", "aieiadiia", "aiaieiid", "aieiaiid",
+		"eaiaidf", "eaieiaddf", "aeaekddii", "eaffafdf", "aiaieiiad",
+		"aieiaiiad", "eaiidf", "eaiiadf", "afaff", "eiiaidf", "afaffa",
+		"aiefaffd", "afaffaead", "aiefaffad", "aff", "aiiaii", "affead",
+		"aiafafa", "aiieiadi", "aieiiadi", "affa", "aiiaiia", "affeada",
+		"aiafaf", "aiieiaid", "aieiiaid", "affaead", "aieffada", "affaeada",
+		"aieffad", "eafaffdf", "aieiafafd", "eaffdf", "eaiiaidf", "eaffadf",
+		"eaiafafdf", "eeaffdfdf", "aieieffadd",};
+
+	if (n == 2)
+		return (t2[code]);
+	if (n == 3)
+		return (t3[code]);
+	if (n == 4)
+		return (t4[code]);
+	if (n == 5)
+		return (t5[code]);
+	if (n == 6)
+		return (t6[code]);
+	return ("");
+}
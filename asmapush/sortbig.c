@@ -6,70 +6,58 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:22:22 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:22:30 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/20 11:02:19 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 // chunks are groups of elements processed sequentially to make sorting large stacks more manageable and efficient.
 #include "push_swap.h"
 
-void	sort100n(t_list **stackA, t_list **stackB)
+void	sort100n(t_ps *ps)
+{
+	sort_chunk(ps, ft_chunks(&ps->a, ps->breaks));
+}
+
+void	sort_chunk(t_ps *ps, int chnk)
 {
-	int		chnk;
 	int		i;
 	t_list	*a;
 
 	i = 0;
-	chnk = ft_chunks(stackA);
-	a = *(stackA);
-	while (ft_lstsize(*stackA) > 0)
+	a = ps->a.top;
+	while (ps->a.size > 0 && !ps->stop)
 	{
 		if (a->index >= chnk * i && a->index <= (chnk * (i + 1)))
 		{
-			pb(stackA, stackB);
+			pb(ps);
 		}
 		else
-			ra(stackA);
-		if (ft_lstsize(*stackB) == chnk * (i + 1))
+			ra(ps);
+		if (ps->b.size == chnk * (i + 1))
 			i++;
-		a = *stackA;
-	}
-	pback(stackA, stackB);
-}
-
-void	cheak_doubls(t_list **stackA)
-{
-	t_list	*node;
-	t_list	*temp_node;
-
-	node = *stackA;
-	temp_node = *stackA;
-	while (temp_node != NULL)
-	{
-		node = temp_node->next;
-		while (node != NULL)
-		{
-			if (temp_node->content == node->content)
-			{
-				ft_lstclear(stackA, free);
-				write(2, "Error\n", 6);
-				exit(1);
-			}
-			node = node->next;
-		}
-		temp_node = temp_node->next;
+		a = ps->a.top;
 	}
+	pback(ps);
 }
 
-int	ft_chunks(t_list **stackA)
+int	ft_chunks(t_stack *stackA, int breaks)
 {
 	int	chnk;
 
-	if (ft_lstsize(*stackA) <= 150)
+	if (stackA->size <= 150)
 		chnk = 15;
 	else
 		chnk = 35;
+	if (breaks < 1)
+		breaks = 1;
+	if ((long)chnk * (stackA->size - 1) / breaks > chnk)
+		chnk = (long)chnk * (stackA->size - 1) / breaks;
+	if (chnk > stackA->size)
+		chnk = stackA->size;
 	return (chnk);
 }
 //
        // If there are 150 or fewer elements, divide into chunks of 15
       // If there are more than 150 elements, divide into chunks of 35
+      // Those sizes fit random input, where almost every neighbour is a
+      // break. With fewer breaks the input is made of longer runs, so the
+      // chunk grows by size / breaks, up to one chunk for the whole stack.
@@ -6,92 +6,82 @@
 /*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/26 14:22:47 by asmalawl          #+#    #+#             */
-/*   Updated: 2024/05/26 14:29:37 by asmalawl         ###   ########.fr       */
+/*   Updated: 2024/06/27 12:03:51 by asmalawl         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "push_swap.h"
 
-void	sort2na(t_list **stackA)
+int	small_code(t_stack *stackA, int n)
 {
 	t_list	*node;
-	int		n1;
-	int		n2;
+	t_list	*next;
+	int		code;
+	int		less;
 
-	node = *stackA;
-	n1 = node->content;
-	n2 = node->next->content;
-	if (n1 > n2)
-		sa(stackA);
-}
-
-void	sort3n(t_list **stackA)
-{
-	int	n1;
-	int	n2;
-	int	n3;
-
-	n1 = (*stackA)->content;
-	n2 = (*stackA)->next->content;
-	n3 = (*stackA)->next->next->content;
-	if ((n1 < n2) && (n2 < n3) && (n1 < n3))
-		return ; //: Simple swap if needed.
-	if ((n1 > n2) && (n2 < n3) && (n1 < n3))
-		sa(stackA); //se specific conditions to swap and rotate elements into the correct order.
-	else if ((n1 > n2) && (n2 > n3) && (n1 > n3))
-	{
-		sa(stackA);//Move the minimum element to stackB, sort the remaining 3 elements, and move the minimum element back.
-		rra(stackA);
-	}
-	else if ((n1 < n2) && (n2 > n3) && (n1 > n3))
-		rra(stackA);
-	else if ((n1 < n2) && (n2 > n3) && (n1 < n3))
+	code = 0;
+	node = stackA->top;
+	while (node != NULL)
 	{
-		sa(stackA);
-		ra(stackA);
+		less = 0;
+		next = node->next;
+		while (next != NULL)
+		{
+			if (next->index < node->index)
+				less++;
+			next = next->next;
+		}
+		code = code * n + less;
+		n--;
+		node = node->next;
 	}
-	else if ((n1 > n2) && (n2 < n3) && (n1 > n3))
-		ra(stackA);
+	return (code);
 }
 
-void	sort4n(t_list **stackA, t_list **stackB)
+void	sort_small(t_ps *ps)
 {
-	int	min;
+	const char	*seq;
 
-	min = find_min(stackA);
-	while ((*stackA)->content != min)
-	{
-		ra(stackA);
-	}
-	pb(stackA, stackB);
-	sort3n(stackA);
-	pa(stackB, stackA);
+	seq = small_table(ps->a.size, small_code(&ps->a, ps->a.size));
+	while (*seq)
+		apply_op(ps, *seq++ - 'a');
 }
 
-void	sort5n(t_list **stackA, t_list **stackB)
+static int	sort_large(t_ps *ps)
 {
-	int	min;
+	t_lis	lis;
 
-	min = find_min(stackA);
-	while ((*stackA)->content != min)
+	ps->breaks = count_breaks(&ps->a);
+	if (!ps->lis && ps->a.size <= PORTFOLIO_MAX && sort_portfolio(ps))
+		return (1);
+	if (!lis_keep(&ps->a, &lis))
 	{
-		if (find_length_min(stackA) > ft_lstsize(*stackA) / 2)
-			rra(stackA);
-		else
-			ra(stackA);
+		lis_free(&lis);
+		return (0);
 	}
-	pb(stackA, stackB);
-	sort4n(stackA, stackB);
-	pa(stackB, stackA);
+	if (ps->lis || lis.len * LIS_RATIO >= ps->a.size)
+		sort_lis(ps, &lis);
+	else if (ps->a.size >= RADIX_MIN && ps->breaks * RADIX_BREAKS > ps->a.size)
+		sort_radix(ps);
+	else
+		sort100n(ps);
+	lis_free(&lis);
+	return (1);
 }
 
+int	sort(t_ps *ps)
+{
+	if (ps->a.size <= SMALL_MAX)
+		sort_small(ps);
+	else if (rotated_sorted(&ps->a))
+		sort_rotate(ps);
+	else if (ps->lis || ps->a.size > BEAM_MAX || !sort_beam(ps))
+		return (sort_large(ps));
+	return (1);
+}
 
-//2 elements: Simple swap if needed.
-///3 elements: Use specific conditions to swap and rotate elements into the correct order.
-//4 elements: Move the minimum element to stackB, sort the remaining 3 elements, and move the minimum element back.
-//5 elements: Move the minimum element to stackB, sort the remaining 4 elements, and move the minimum element back.
-//more than 5 ; Find the minimum element and move it to the top of the stack.
-// Push the minimum element to stackB.
-// Sort the remaining 4 elements in stackA using sort4n.
-// Push the minimum element back into stackA after sorting.
-
+//small_code: Lehmer code of the index sequence, i.e. the position of the
+//permutation in small_table.
+//sort_small: stacks of 2..SMALL_MAX elements replay the shortest sequence
+//found by tools/gen_small.c, so the result is always optimal.
+//sort: picks the engine by size and shape; 0 only when memory ran out.
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/13 10:05:44 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/24 10:33:02 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+void	stack_add_top(t_stack *stack, t_list *node)
+{
+	node->prev = NULL;
+	node->next = stack->top;
+	if (stack->top != NULL)
+		stack->top->prev = node;
+	else
+		stack->bottom = node;
+	stack->top = node;
+	stack->size++;
+	track_top(stack, node);
+	track_in(stack, node);
+}
+
+t_list	*stack_pop(t_stack *stack)
+{
+	t_list	*node;
+
+	node = stack->top;
+	if (node == NULL)
+		return (NULL);
+	stack->top = node->next;
+	if (stack->top != NULL)
+		stack->top->prev = NULL;
+	else
+		stack->bottom = NULL;
+	stack->size--;
+	track_out(stack, node);
+	return (node);
+}
+
+void	stack_swap(t_stack *stack)
+{
+	t_list	*first;
+	t_list	*second;
+	int		key;
+
+	first = stack->top;
+	second = first->next;
+	first->next = second->next;
+	if (second->next != NULL)
+		second->next->prev = first;
+	else
+		stack->bottom = first;
+	second->prev = NULL;
+	second->next = first;
+	first->prev = second;
+	stack->top = second;
+	if (stack->key == NULL)
+		return ;
+	key = stack->key[first->index];
+	stack->key[first->index] = stack->key[second->index];
+	stack->key[second->index] = key;
+}
+
+void	stack_rotate(t_stack *stack)
+{
+	t_list	*node;
+
+	node = stack->top;
+	stack->top = node->next;
+	stack->top->prev = NULL;
+	node->next = NULL;
+	node->prev = stack->bottom;
+	stack->bottom->next = node;
+	stack->bottom = node;
+	if (stack->key != NULL)
+		stack->key[node->index] = stack->key[node->prev->index] + 1;
+}
+
+void	stack_rrotate(t_stack *stack)
+{
+	t_list	*node;
+
+	node = stack->bottom;
+	stack->bottom = node->prev;
+	stack->bottom->next = NULL;
+	node->prev = NULL;
+	node->next = stack->top;
+	stack->top->prev = node;
+	stack->top = node;
+	if (stack->key != NULL)
+		stack->key[node->index] = stack->key[node->next->index] - 1;
+}
+
+//Moves shared by both stacks, without any output and without size checks:
+//op_apply in ops.c only calls them when the stack holds enough nodes (one
+//for stack_pop, two for the others).
+//Once stack_track has run, every move also keeps key[] and min/max current.
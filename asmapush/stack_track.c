@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack_track.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/15 14:40:06 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/15 14:40:06 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+int	stack_track(t_stack *stack, int cap)
+{
+	t_list	*node;
+
+	stack->cap = cap;
+	stack->min = cap + 1;
+	stack->max = 0;
+	stack->key = malloc(sizeof(int) * (cap + 2));
+	stack->in = ft_calloc(cap + 2, sizeof(char));
+	if (stack->key == NULL || stack->in == NULL)
+		return (0);
+	node = stack->bottom;
+	while (node != NULL)
+	{
+		track_top(stack, node);
+		track_in(stack, node);
+		node = node->prev;
+	}
+	return (1);
+}
+
+void	track_top(t_stack *stack, t_list *node)
+{
+	if (stack->key == NULL)
+		return ;
+	if (node->next == NULL)
+		stack->key[node->index] = 0;
+	else
+		stack->key[node->index] = stack->key[node->next->index] - 1;
+}
+
+void	track_in(t_stack *stack, t_list *node)
+{
+	if (stack->in == NULL)
+		return ;
+	stack->in[node->index] = 1;
+	if (node->index > stack->max)
+		stack->max = node->index;
+	if (node->index < stack->min)
+		stack->min = node->index;
+}
+
+void	track_out(t_stack *stack, t_list *node)
+{
+	if (stack->in == NULL)
+		return ;
+	stack->in[node->index] = 0;
+	if (node->index == stack->max)
+		while (stack->max > 0 && !stack->in[stack->max])
+			stack->max--;
+	if (node->index == stack->min)
+		while (stack->min <= stack->cap && !stack->in[stack->min])
+			stack->min++;
+}
+
+int	stack_pos(t_stack *stack, int index)
+{
+	return (stack->key[index] - stack->key[stack->top->index]);
+}
+
+//Rank bookkeeping for one stack, indexed by node->index (1..cap).
+//key[] only grows towards the bottom: a node's distance from the top is its
+//key minus the key of the top node, so rotations touch a single key.
+//in[] marks the ranks held by the stack; min and max follow pushes at once
+//and walk to the next held rank when they are popped, which adds up to
+//O(n) for a stack that is only emptied, like B in pback.
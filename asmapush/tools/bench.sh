@@ -0,0 +1,76 @@
+#!/bin/sh
+# **************************************************************************** #
+#                                                                              #
+#                                                         :::      ::::::::    #
+#    bench.sh                                           :+:      :+:    :+:    #
+#                                                     +:+ +:+         +:+      #
+#    By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+         #
+#                                                 +#+#+#+#+#+   +#+            #
+#    Created: 2024/06/11 09:30:14 by asmalawl          #+#    #+#              #
+#    Updated: 2024/06/11 09:30:17 by asmalawl         ###   ########.fr        #
+#                                                                              #
+# **************************************************************************** #
+
+# Runs push_swap on seeded random permutations, checks every output with
+# checker and prints one CSV line per size:
+#   n,runs,min,mean,p99,max,ms_mean
+# Exits 1 if an output is not OK or a size goes over its limit in
+# tools/bench_limits ("<n> <max operations>" per line).
+# BENCH_SIZES="n:runs ..." and BENCH_SEED override the defaults.
+
+cd "$(dirname "$0")/.." || exit 1
+SIZES=${BENCH_SIZES:-"3:50 5:50 100:50 500:20 1000:10 10000:3"}
+SEED=${BENCH_SEED:-42}
+LIMITS=tools/bench_limits
+FAIL=0
+
+permutation() {
+	awk -v n="$1" -v seed="$2" 'BEGIN {
+		srand(seed);
+		for (i = 0; i < n; i++) v[i] = i * 3 - n;
+		for (i = n - 1; i > 0; i--) {
+			j = int(rand() * (i + 1)); t = v[i]; v[i] = v[j]; v[j] = t;
+		}
+		for (i = 0; i < n; i++) printf "%d ", v[i];
+	}'
+}
+
+now_ms() {
+	date +%s%N | cut -c1-13
+}
+
+echo "n,runs,min,mean,p99,max,ms_mean"
+for entry in $SIZES; do
+	n=${entry%%:*}
+	runs=${entry#*:}
+	counts=""
+	total_ms=0
+	run=0
+	while [ "$run" -lt "$runs" ]; do
+		arg=$(permutation "$n" $((SEED + run)))
+		start=$(now_ms)
+		./push_swap $arg > /tmp/bench_ops.$$
+		end=$(now_ms)
+		total_ms=$((total_ms + end - start))
+		if [ "$(./checker $arg < /tmp/bench_ops.$$)" != "OK" ]; then
+			echo "KO: n=$n seed=$((SEED + run))" >&2
+			FAIL=1
+		fi
+		counts="$counts $(wc -l < /tmp/bench_ops.$$)"
+		run=$((run + 1))
+	done
+	line=$(echo "$counts" | tr ' ' '\n' | grep . | sort -n | awk -v n="$n" \
+		-v ms="$total_ms" '{ c[NR] = $1; s += $1 } END {
+		p = int(NR * 0.99); if (p < NR * 0.99) p++; if (p < 1) p = 1;
+		printf "%d,%d,%d,%.1f,%d,%d,%.1f\n", n, NR, c[1], s / NR, c[p],
+			c[NR], ms / NR }')
+	echo "$line"
+	limit=$(awk -v n="$n" '$1 == n { print $2 }' "$LIMITS")
+	max=$(echo "$line" | cut -d, -f6)
+	if [ -n "$limit" ] && [ "$max" -gt "$limit" ]; then
+		echo "regression: n=$n max $max > $limit" >&2
+		FAIL=1
+	fi
+done
+rm -f /tmp/bench_ops.$$
+exit $FAIL
@@ -0,0 +1,507 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_ps.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/27 10:03:52 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/27 15:44:10 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// In-process fuzz and differential driver for pars and sort, run through
+// `make fuzz`. Every round ends with ps_free and the next one reuses the
+// t_ps, so an exit or a field left behind by the last run shows up here.
+//   1. FUZZ_ARGV random argv vectors go through pars and a reference
+//      parser; both must agree on accept/reject and on the values.
+//   2. FUZZ_RUNS seeded permutations per size bucket, with and without
+//      --lis, go through sort; the ops are replayed on the checker's ring
+//      model and must leave A sorted and B empty.
+//   3. FUZZ_OPS random ops go through op_apply, the checker's ring_apply
+//      and the beam's beam_apply, which must agree after every step, and
+//      are then undone with op_inverse in reverse order.
+//   4. The op total of each bucket is compared with tools/fuzz_baseline
+//      and a bucket that got longer fails the run.
+// Usage: fuzz_ps [--record] [seed]. --record rewrites the baseline, seed
+// only changes the argv fuzz; the permutations always use FUZZ_SEED.
+#include "../push_swap.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define FUZZ_SEED 42
+#define FUZZ_ARGV 20000
+#define FUZZ_RUNS 10
+#define FUZZ_BUCKETS 5
+#define FUZZ_BASELINE "tools/fuzz_baseline"
+#define FUZZ_OPS 2000000
+#define FUZZ_ARG 24
+#define FUZZ_RAND_LEN 12
+
+static const int	g_bucket[FUZZ_BUCKETS][2] = {{2, 6}, {7, 20}, {21, 100},
+	{101, 500}, {501, 3000}};
+// A g_edge token longer than FUZZ_ARG does not compile; fuzz_arg copies
+// whole rows and terminates them, so one of exactly FUZZ_ARG still fits.
+static const char	g_edge[8][FUZZ_ARG] = {"2147483647", "-2147483648",
+	"2147483648", "-2147483649", "+0", "-0", "00000000000000000042",
+	"--lis"};
+static const char	g_chars[] = "0123456789  +-\tx";
+static unsigned int	g_rand;
+static int			g_inside;
+
+static unsigned int	rnd(void)
+{
+	g_rand ^= g_rand << 13;
+	g_rand ^= g_rand >> 17;
+	g_rand ^= g_rand << 5;
+	return (g_rand);
+}
+
+_Static_assert(FUZZ_RAND_LEN <= FUZZ_ARG, "random tokens overflow args");
+
+static void	exit_guard(void)
+{
+	if (!g_inside)
+		return ;
+	fprintf(stderr, "fuzz: exit called from inside pars or sort\n");
+	_exit(1);
+}
+
+static char	*ref_token(char *s, long *out)
+{
+	int	sign;
+	int	digits;
+
+	sign = 1;
+	if (*s == '+' || *s == '-')
+		if (*s++ == '-')
+			sign = -1;
+	*out = 0;
+	digits = 0;
+	while (*s >= '0' && *s <= '9')
+	{
+		if (*out <= (long)INT_MAX + 1)
+			*out = *out * 10 + (*s - '0');
+		s++;
+		digits++;
+	}
+	*out *= sign;
+	if (digits == 0 || *out > INT_MAX || *out < INT_MIN
+		|| (*s != '\0' && !strchr(" \t\n\v\f\r", *s)))
+		return (NULL);
+	return (s);
+}
+
+// Reference rules, written independently of parsing.c: whitespace
+// separated tokens, an optional sign before digits, int range, at least
+// one token and no duplicates.
+static int	ref_parse(char **av, int *values, int *n)
+{
+	char	*s;
+	long	v;
+	int		i;
+
+	*n = 0;
+	while (*++av)
+	{
+		s = *av;
+		while (*s)
+		{
+			if (strchr(" \t\n\v\f\r", *s) && ++s)
+				continue ;
+			s = ref_token(s, &v);
+			if (s == NULL)
+				return (0);
+			i = -1;
+			while (++i < *n)
+				if (values[i] == v)
+					return (0);
+			values[(*n)++] = v;
+		}
+	}
+	return (*n > 0);
+}
+
+static void	fuzz_arg(char *buf)
+{
+	int	len;
+	int	i;
+
+	if (rnd() % 8 == 0)
+	{
+		memcpy(buf, g_edge[rnd() % 8], FUZZ_ARG);
+		buf[FUZZ_ARG] = '\0';
+		return ;
+	}
+	len = rnd() % (FUZZ_RAND_LEN + 1);
+	i = 0;
+	while (i < len)
+		buf[i++] = g_chars[rnd() % (sizeof(g_chars) - 1)];
+	buf[i] = '\0';
+}
+
+static int	check_pars(t_ps *ps, char **av)
+{
+	int		values[64];
+	int		n;
+	int		i;
+	int		ok;
+	t_list	*node;
+
+	ok = ref_parse(av, values, &n);
+	g_inside = 1;
+	i = pars(ps, av);
+	g_inside = 0;
+	if (i != ok)
+		return (0);
+	node = ps->a.top;
+	i = 0;
+	while (ok && i < n && node != NULL && node->content == values[i])
+	{
+		node = node->next;
+		i++;
+	}
+	return (!ok || (i == n && node == NULL && ps->a.size == n));
+}
+
+static int	fuzz_pars(int rounds)
+{
+	char	args[4][FUZZ_ARG + 1];
+	char	*av[6];
+	t_ps	ps;
+	int		argc;
+
+	ft_bzero(&ps, sizeof(t_ps));
+	while (rounds-- > 0)
+	{
+		argc = 1 + rnd() % 4;
+		av[0] = "push_swap";
+		av[argc + 1] = NULL;
+		while (argc > 0)
+		{
+			fuzz_arg(args[argc - 1]);
+			av[argc] = args[argc - 1];
+			argc--;
+		}
+		if (!check_pars(&ps, av))
+		{
+			fprintf(stderr, "fuzz: pars disagrees on \"%s\" \"%s\"\n", av[1],
+				av[2] ? av[2] : "");
+			return (0);
+		}
+		ps_free(&ps);
+	}
+	return (1);
+}
+
+static int	replay(t_ps *ps, int *values, int n)
+{
+	t_ring	a;
+	t_ring	b;
+	size_t	i;
+	int		ok;
+
+	ok = ring_init(&a, n, values, n) && ring_init(&b, n, NULL, 0);
+	i = 0;
+	while (ok && i < ps->out.len)
+		ring_apply(&a, &b, ps->out.buf[i++]);
+	ok = ok && a.size == n && b.size == 0;
+	i = 1;
+	while (ok && (int)i < n)
+	{
+		ok = a.buf[(a.head + i - 1) % a.cap] < a.buf[(a.head + i) % a.cap];
+		i++;
+	}
+	free(a.buf);
+	free(b.buf);
+	return (ok);
+}
+
+static char	*join_values(int *values, int n)
+{
+	char	*text;
+	int		len;
+	int		i;
+
+	text = malloc(n * 13 + 1);
+	if (text == NULL)
+		return (NULL);
+	len = 0;
+	i = 0;
+	while (i < n)
+		len += sprintf(text + len, "%d ", values[i++]);
+	return (text);
+}
+
+// Same pipeline as main: pars, skip an already sorted input, ranks,
+// tracking, sort. Returns the number of ops, -1 on a wrong result.
+static long	run_sort(int *values, int n, int lis)
+{
+	t_ps	ps;
+	char	*av[3];
+	long	len;
+
+	ft_bzero(&ps, sizeof(t_ps));
+	av[0] = "push_swap";
+	av[1] = join_values(values, n);
+	av[2] = NULL;
+	ps.lis = lis;
+	len = -1;
+	g_inside = 1;
+	if (av[1] != NULL && pars(&ps, av))
+	{
+		if (sorted(&ps.a))
+			len = 0;
+		else if (fill_index(&ps.a) && stack_track(&ps.a, ps.a.size)
+			&& stack_track(&ps.b, ps.a.size) && sort(&ps)
+			&& replay(&ps, values, n))
+			len = ps.out.len;
+	}
+	g_inside = 0;
+	free(av[1]);
+	ps_free(&ps);
+	return (len);
+}
+
+static void	shuffle(int *values, int n)
+{
+	int	i;
+	int	j;
+	int	t;
+
+	i = -1;
+	while (++i < n)
+		values[i] = i * 3 - n;
+	while (--i > 0)
+	{
+		j = rnd() % (i + 1);
+		t = values[i];
+		values[i] = values[j];
+		values[j] = t;
+	}
+}
+
+static int	same_stack(t_list *x, t_ring *r, unsigned char *s, int len)
+{
+	int	i;
+
+	i = 0;
+	while (x != NULL && i < len && i < r->size
+		&& x->content == r->buf[(r->head + i) % r->cap] && x->index == s[i])
+	{
+		x = x->next;
+		i++;
+	}
+	return (x == NULL && i == len && i == r->size);
+}
+
+static int	ops_setup(t_ps *ps, t_ring *r, t_bnode *node, int *values)
+{
+	char	*av[3];
+	t_list	*x;
+	int		ok;
+	int		i;
+
+	shuffle(values, BEAM_MAX);
+	av[0] = "push_swap";
+	av[1] = join_values(values, BEAM_MAX);
+	av[2] = NULL;
+	ok = av[1] != NULL && pars(ps, av) && fill_index(&ps->a)
+		&& stack_track(&ps->a, BEAM_MAX) && stack_track(&ps->b, BEAM_MAX)
+		&& ring_init(&r[0], BEAM_MAX, values, BEAM_MAX)
+		&& ring_init(&r[1], BEAM_MAX, NULL, 0);
+	free(av[1]);
+	node->la = BEAM_MAX;
+	x = ps->a.top;
+	i = 0;
+	while (ok && x != NULL)
+	{
+		node->s[i++] = x->index;
+		x = x->next;
+	}
+	return (ok);
+}
+
+// Forward pass: the three models must agree on which ops are legal and on
+// both stacks afterwards. Returns the number of ops applied, -1 on a
+// disagreement.
+static long	ops_forward(t_ps *ps, t_ring *r, t_bnode *node, unsigned char *log)
+{
+	long	len;
+	long	i;
+	int		op;
+	int		applied;
+
+	len = 0;
+	i = -1;
+	while (++i < FUZZ_OPS)
+	{
+		op = rnd() % 11;
+		applied = op_apply(ps, op);
+		if (applied != beam_apply(node, BEAM_MAX, op))
+			return (-1);
+		if (applied)
+		{
+			ring_apply(&r[0], &r[1], op);
+			log[len++] = op;
+		}
+		if (!same_stack(ps->a.top, &r[0], node->s, node->la)
+			|| !same_stack(ps->b.top, &r[1], node->s + node->la,
+				BEAM_MAX - node->la))
+			return (-1);
+	}
+	return (len);
+}
+
+static int	restored(t_ps *ps, int *values)
+{
+	t_list	*x;
+	int		i;
+
+	x = ps->a.top;
+	i = 0;
+	while (x != NULL && i < BEAM_MAX && x->content == values[i])
+	{
+		x = x->next;
+		i++;
+	}
+	return (x == NULL && i == BEAM_MAX && ps->b.size == 0);
+}
+
+// Backward pass: op_inverse of every applied op, newest first, must be
+// legal again and give back the starting stacks. Only this pass is timed.
+static int	fuzz_ops(void)
+{
+	t_ps			ps;
+	t_ring			r[2];
+	t_bnode			node;
+	unsigned char	*log;
+	int				values[BEAM_MAX];
+	long			len[2];
+	struct timespec	t[2];
+
+	ft_bzero(&ps, sizeof(t_ps));
+	ft_bzero(r, sizeof(r));
+	log = malloc(FUZZ_OPS);
+	len[0] = -1;
+	if (log != NULL && ops_setup(&ps, r, &node, values))
+		len[0] = ops_forward(&ps, r, &node, log);
+	len[1] = len[0];
+	clock_gettime(CLOCK_MONOTONIC, &t[0]);
+	while (len[1] > 0 && op_apply(&ps, op_inverse(log[len[1] - 1])))
+		len[1]--;
+	clock_gettime(CLOCK_MONOTONIC, &t[1]);
+	len[1] = (len[0] >= 0 && len[1] == 0 && restored(&ps, values));
+	if (len[1])
+		printf("ops: %ld of %d random ops undone, %.1f ns per op\n", len[0],
+			FUZZ_OPS, ((t[1].tv_sec - t[0].tv_sec) * 1e9 + t[1].tv_nsec
+				- t[0].tv_nsec) / (len[0] + !len[0]));
+	else
+		fprintf(stderr, "fuzz: op kernel round trip failed\n");
+	free(log);
+	free(r[0].buf);
+	free(r[1].buf);
+	ps_free(&ps);
+	return (len[1]);
+}
+
+static long	fuzz_bucket(int lo, int hi, int lis)
+{
+	int		*values;
+	long	total;
+	long	len;
+	int		run;
+	int		n;
+
+	values = malloc(sizeof(int) * hi);
+	total = -(values == NULL);
+	run = 0;
+	while (total >= 0 && run++ < FUZZ_RUNS)
+	{
+		n = lo + rnd() % (hi - lo + 1);
+		shuffle(values, n);
+		len = run_sort(values, n, lis);
+		if (len < 0)
+		{
+			fprintf(stderr, "fuzz: wrong sort, n=%d lis %d run %d\n",
+				n, lis, run);
+			total = -1;
+		}
+		else
+			total += len;
+	}
+	free(values);
+	return (total);
+}
+
+static int	fuzz_sort(long *totals)
+{
+	int	b;
+	int	lis;
+
+	g_rand = FUZZ_SEED;
+	b = 0;
+	while (b < FUZZ_BUCKETS * 2)
+	{
+		lis = b % 2;
+		totals[b] = fuzz_bucket(g_bucket[b / 2][0], g_bucket[b / 2][1], lis);
+		if (totals[b] < 0)
+			return (0);
+		printf("%d-%d%s: %ld ops\n", g_bucket[b / 2][0], g_bucket[b / 2][1],
+			(lis ? " --lis" : ""), totals[b]);
+		b++;
+	}
+	return (1);
+}
+
+// Baseline lines: "<lo> <hi> <lis> <total ops>", one per bucket and mode.
+static int	baseline(long *totals, int record)
+{
+	FILE	*f;
+	long	want[4];
+	int		b;
+	int		ok;
+
+	f = fopen(FUZZ_BASELINE, (record ? "w" : "r"));
+	ok = (f != NULL);
+	if (!ok)
+		fprintf(stderr, "fuzz: cannot open %s\n", FUZZ_BASELINE);
+	b = -1;
+	while (ok && ++b < FUZZ_BUCKETS * 2)
+	{
+		if (record)
+			fprintf(f, "%d %d %d %ld\n", g_bucket[b / 2][0],
+				g_bucket[b / 2][1], b % 2, totals[b]);
+		else if (fscanf(f, "%ld %ld %ld %ld", &want[0], &want[1], &want[2],
+				&want[3]) != 4 || totals[b] > want[3])
+		{
+			fprintf(stderr, "fuzz: regression, bucket %d-%d lis %d: %ld ops, "
+				"baseline %ld\n", g_bucket[b / 2][0], g_bucket[b / 2][1],
+				b % 2, totals[b], want[3]);
+			ok = 0;
+		}
+	}
+	if (f != NULL)
+		fclose(f);
+	return (ok);
+}
+
+int	main(int ac, char **av)
+{
+	long	totals[FUZZ_BUCKETS * 2];
+	int		record;
+
+	record = (ac > 1 && strcmp(av[1], "--record") == 0);
+	g_rand = FUZZ_SEED;
+	if (ac > 1 + record)
+		g_rand = atoi(av[1 + record]) | 1;
+	atexit(exit_guard);
+	dup2(open("/dev/null", O_RDONLY), 0);
+	if (!fuzz_pars(FUZZ_ARGV) || !fuzz_ops() || !fuzz_sort(totals)
+		|| !baseline(totals, record))
+		return (1);
+	printf("fuzz: ok, %d argv vectors, %d sorts\n", FUZZ_ARGV,
+		FUZZ_BUCKETS * 2 * FUZZ_RUNS);
+	return (0);
+}
@@ -0,0 +1,229 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_small.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/02 10:12:41 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/02 10:12:44 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// Generates small_table.c: for every permutation of 2..SMALL_MAX ranks the
+// shortest operation sequence, found by BFS over all 11 operations.
+// Run through `make table`; the output is committed so builds stay offline.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SMALL_MAX 6
+
+static const int	g_fact[SMALL_MAX + 1] = {1, 1, 2, 6, 24, 120, 720};
+
+static int	lehmer(const int *seq, int n)
+{
+	int	code;
+	int	i;
+	int	j;
+	int	less;
+
+	code = 0;
+	i = -1;
+	while (++i < n)
+	{
+		less = 0;
+		j = i;
+		while (++j < n)
+			if (seq[j] < seq[i])
+				less++;
+		code += less * g_fact[n - 1 - i];
+	}
+	return (code);
+}
+
+static void	unlehmer(int code, int *seq, int n)
+{
+	int	used[SMALL_MAX];
+	int	i;
+	int	d;
+	int	v;
+
+	memset(used, 0, sizeof(used));
+	i = -1;
+	while (++i < n)
+	{
+		d = code / g_fact[n - 1 - i];
+		code %= g_fact[n - 1 - i];
+		v = 0;
+		while (used[v] || d > 0)
+		{
+			if (!used[v])
+				d--;
+			v++;
+		}
+		used[v] = 1;
+		seq[i] = v;
+	}
+}
+
+static void	rot(int *s, int len, int up)
+{
+	int	t;
+
+	if (up)
+	{
+		t = s[0];
+		memmove(s, s + 1, sizeof(int) * (len - 1));
+		s[len - 1] = t;
+		return ;
+	}
+	t = s[len - 1];
+	memmove(s + 1, s, sizeof(int) * (len - 1));
+	s[0] = t;
+}
+
+/* seq holds A top->bottom followed by B top->bottom; *la is the size of A. */
+static int	apply(int *s, int *la, int n, int op)
+{
+	int	lb;
+	int	t;
+
+	lb = n - *la;
+	if (((op == 0 || op == 2) && *la < 2) || ((op == 1 || op == 2) && lb < 2)
+		|| (op == 3 && lb < 1) || (op == 4 && *la < 1)
+		|| ((op == 5 || op == 7 || op == 8 || op == 10) && *la < 2)
+		|| ((op == 6 || op == 7 || op == 9 || op == 10) && lb < 2))
+		return (0);
+	if (op == 0 || op == 2)
+	{
+		t = s[0];
+		s[0] = s[1];
+		s[1] = t;
+	}
+	if (op == 1 || op == 2)
+	{
+		t = s[*la];
+		s[*la] = s[*la + 1];
+		s[*la + 1] = t;
+	}
+	if (op == 3)
+		rot(s, ++(*la), 0);
+	if (op == 4)
+		rot(s, (*la)--, 1);
+	if (op == 5 || op == 7 || op == 8 || op == 10)
+		rot(s, *la, op < 8);
+	if (op == 6 || op == 7 || op == 9 || op == 10)
+		rot(s + *la, lb, op < 8);
+	return (1);
+}
+
+static void	bfs(unsigned char *dist, int n)
+{
+	int	*queue;
+	int	head;
+	int	tail;
+	int	s[SMALL_MAX];
+	int	la;
+	int	op;
+	int	next;
+
+	queue = malloc(sizeof(int) * g_fact[n] * (n + 1));
+	memset(dist, 255, g_fact[n] * (n + 1));
+	dist[n] = 0;
+	queue[0] = n;
+	head = 0;
+	tail = 1;
+	while (head < tail)
+	{
+		op = -1;
+		while (++op < 11)
+		{
+			unlehmer(queue[head] / (n + 1), s, n);
+			la = queue[head] % (n + 1);
+			if (!apply(s, &la, n, op))
+				continue ;
+			next = lehmer(s, n) * (n + 1) + la;
+			if (dist[next] != 255)
+				continue ;
+			dist[next] = dist[queue[head]] + 1;
+			queue[tail++] = next;
+		}
+		head++;
+	}
+	free(queue);
+}
+
+static int	emit_path(const unsigned char *dist, int n, int code)
+{
+	int	cur;
+	int	s[SMALL_MAX];
+	int	la;
+	int	op;
+	int	next;
+
+	cur = code * (n + 1) + n;
+	next = cur;
+	printf("\"");
+	while (dist[cur] > 0)
+	{
+		op = -1;
+		while (++op < 11)
+		{
+			unlehmer(cur / (n + 1), s, n);
+			la = cur % (n + 1);
+			if (!apply(s, &la, n, op))
+				continue ;
+			next = lehmer(s, n) * (n + 1) + la;
+			if (dist[next] == dist[cur] - 1)
+				break ;
+		}
+		printf("%c", 'a' + op);
+		cur = next;
+	}
+	printf("\"");
+	return (dist[code * (n + 1) + n] + 2);
+}
+
+static void	emit_table(int n)
+{
+	unsigned char	*dist;
+	int				code;
+	int				col;
+
+	dist = malloc(g_fact[n] * (n + 1));
+	bfs(dist, n);
+	printf("\tstatic const char\t*t%d[%d] = {", n, g_fact[n]);
+	col = 80;
+	code = -1;
+	while (++code < g_fact[n])
+	{
+		if (col + 14 > 80)
+		{
+			printf("\n\t\t");
+			col = 8;
+		}
+		else
+			col += printf(" ");
+		col += emit_path(dist, n, code) + printf(",");
+	}
+	printf("};\n\n");
+	free(dist);
+}
+
+int	main(void)
+{
+	int	n;
+
+	printf("/* Generated by tools/gen_small.c (make table). Do not edit. */\n\n");
+	printf("#include \"push_swap.h\"\n\n");
+	printf("const char\t*small_table(int n, int code)\n{\n");
+	n = 1;
+	while (++n <= SMALL_MAX)
+		emit_table(n);
+	n = 1;
+	while (++n <= SMALL_MAX)
+		printf("\tif (n == %d)\n\t\treturn (t%d[code]);\n", n, n);
+	printf("\treturn (\"\");\n}\n");
+	return (0);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unpack.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: asmalawl <asmalawl@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/25 16:02:37 by asmalawl          #+#    #+#             */
+/*   Updated: 2024/06/25 16:02:37 by asmalawl         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "push_swap.h"
+
+static int	unpack_nib(t_pack *pk)
+{
+	int	nib;
+
+	if (pk->pos >= pk->len)
+		return (-1);
+	if (pk->half)
+		nib = pk->buf[pk->pos++] & 15;
+	else
+		nib = pk->buf[pk->pos] >> 4;
+	pk->half = !pk->half;
+	return (nib);
+}
+
+static long	unpack_run(t_pack *pk, int code)
+{
+	long	run;
+	int		nib;
+	int		k;
+
+	run = 0;
+	k = 1 + 3 * (code == PACK_LONG);
+	while (k-- > 0)
+	{
+		nib = unpack_nib(pk);
+		if (nib < 0)
+			return (-1);
+		run = run << 4 | nib;
+	}
+	return (run + 1);
+}
+
+static int	unpack_mix(t_pack *pk, t_ops *ops)
+{
+	int	mask;
+	int	last;
+	int	prev;
+	int	bit;
+
+	mask = unpack_nib(pk);
+	if (mask < 0 || pk->prev < 0 || ops->len + 4 > ops->cap)
+		return (0);
+	last = pk->last;
+	prev = pk->prev;
+	bit = 4;
+	while (bit-- > 0)
+	{
+		if (mask >> bit & 1)
+			ops->buf[ops->len] = last;
+		else
+			ops->buf[ops->len] = prev;
+		pack_seen(pk, ops->buf[ops->len++]);
+	}
+	return (1);
+}
+
+static int	unpack_step(t_pack *pk, t_ops *ops)
+{
+	int		code;
+	long	run;
+
+	code = unpack_nib(pk);
+	if (code >= 0 && code <= OP_RRR)
+	{
+		ops->buf[ops->len++] = code;
+		pack_seen(pk, code);
+		return (1);
+	}
+	if (code == PACK_MIX)
+		return (unpack_mix(pk, ops));
+	if (code != PACK_REP && code != PACK_LONG)
+		return (0);
+	run = unpack_run(pk, code);
+	if (run < 0 || pk->last < 0 || ops->len + run > ops->cap)
+		return (0);
+	while (run-- > 0)
+		ops->buf[ops->len++] = pk->last;
+	return (1);
+}
+
+int	unpack_ops(t_pack *pk, t_ops *ops)
+{
+	pk->last = -1;
+	pk->prev = -1;
+	pk->half = 0;
+	ops->len = 0;
+	while (ops->len < ops->cap)
+		if (!unpack_step(pk, ops))
+			return (0);
+	return (1);
+}
+
+//Decoder for the codes written by pack_ops. pk->buf/len is the stream and
+//pk->pos the read position; ops->cap is the op count from the header and
+//ops->buf has room for it. Any code that would run past it is an error.